@@ -6,8 +6,6 @@
 // Sets default values
 ACapsuleRoomba::ACapsuleRoomba()
 {
- 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
 	Vessel->SetEffectShapeType(EEffectShapeType::Capsule);
 }
 
@@ -18,10 +16,3 @@ void ACapsuleRoomba::BeginPlay()
 	
 }
 
-// Called every frame
-void ACapsuleRoomba::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
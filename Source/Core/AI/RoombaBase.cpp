@@ -2,13 +2,15 @@
 
 
 #include "RoombaBase.h"
+#include "RoombaSensingSubsystem.h"
 #include "../Character/SpeegyptCharacter.h"
 
 // Sets default values
 ARoombaBase::ARoombaBase()
 {
- 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// Roombas are driven by their AI controller and movement component, so the actor itself doesn't need to tick.
+	// Blueprints that implement Event Tick turn it back on.
+	PrimaryActorTick.bCanEverTick = false;
 
 	Mesh1P = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh1P"));
 	Mesh1P->SetupAttachment(RootComponent);
@@ -27,12 +29,9 @@ ARoombaBase::ARoombaBase()
 	Vessel->SetupAttachment(Mesh1P);
 
 	// makes it so the effect sphere of the effects is centered on the player, not the vessel in their hand.
-	Vessel->Effects.CyanEffect->SetupAttachment(GetCapsuleComponent());
-	Vessel->Effects.MagentaEffect->SetupAttachment(GetCapsuleComponent());
-	Vessel->Effects.YellowEffect->SetupAttachment(GetCapsuleComponent());
-	Vessel->Effects.VioletEffect->SetupAttachment(GetCapsuleComponent());
+	Vessel->EffectAttachParent = GetCapsuleComponent();
 
-	Vessel->Effects.CyanEffect->ForceMagnitude = 100;
+	Vessel->CyanForceMagnitude = 100;
 
 	Path = CreateDefaultSubobject<USplineComponent>(TEXT("Path"));
 	Path->SetAbsolute(true, true, true);
@@ -43,19 +42,102 @@ ARoombaBase::ARoombaBase()
 void ARoombaBase::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	RebuildPathTable();
+
+	URoombaSensingSubsystem* Sensing = URoombaSensingSubsystem::Get(GetWorld());
+	if (Sensing)
+		Sensing->Register(this);
+}
+
+void ARoombaBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	URoombaSensingSubsystem* Sensing = URoombaSensingSubsystem::Get(GetWorld());
+	if (Sensing)
+		Sensing->Unregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ARoombaBase::RebuildPathTable()
+{
+	PathLocations.Reset();
+	PathDirections.Reset();
+
+	PathLength = Path->GetSplineLength();
+	bIsPathClosed = Path->IsClosedLoop();
+	PathSampleSpacing = FMath::Max(PathSampleSpacing, 1.f);
+
+	int32 NumSamples = FMath::CeilToInt(PathLength / PathSampleSpacing) + 1;
+	PathLocations.Reserve(NumSamples);
+	PathDirections.Reserve(NumSamples);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		float Distance = FMath::Min(i * PathSampleSpacing, PathLength);
+		PathLocations.Add(Path->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+		PathDirections.Add(Path->GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+	}
+}
+
+void ARoombaBase::GetPathSample(float Distance, int32& OutIndex, float& OutAlpha) const
+{
+	if (bIsPathClosed && PathLength > 0)
+	{
+		Distance = FMath::Fmod(Distance, PathLength);
+		if (Distance < 0)
+			Distance += PathLength;
+	}
+	else
+		Distance = FMath::Clamp(Distance, 0.f, PathLength);
+
+	float Sample = Distance / PathSampleSpacing;
+	OutIndex = FMath::Min(FMath::FloorToInt(Sample), PathLocations.Num() - 2);
+
+	// The last sample sits at the end of the path rather than a full spacing after the one before it.
+	float SegmentLength = FMath::Min(PathSampleSpacing, PathLength - OutIndex * PathSampleSpacing);
+	OutAlpha = SegmentLength > 0 ? FMath::Clamp((Distance - OutIndex * PathSampleSpacing) / SegmentLength, 0.f, 1.f) : 0.f;
 }
 
-// Called every frame
-void ARoombaBase::Tick(float DeltaTime)
+FVector ARoombaBase::GetPathLocationAtDistance(float Distance) const
 {
-	Super::Tick(DeltaTime);
+	if (PathLocations.Num() < 2)
+		return PathLocations.Num() ? PathLocations[0] : GetActorLocation();
+
+	int32 Index;
+	float Alpha;
+	GetPathSample(Distance, Index, Alpha);
+	return FMath::Lerp(PathLocations[Index], PathLocations[Index + 1], Alpha);
+}
+
+FVector ARoombaBase::GetPathDirectionAtDistance(float Distance) const
+{
+	if (PathDirections.Num() < 2)
+		return PathDirections.Num() ? PathDirections[0] : GetActorForwardVector();
+
+	int32 Index;
+	float Alpha;
+	GetPathSample(Distance, Index, Alpha);
+	return FMath::Lerp(PathDirections[Index], PathDirections[Index + 1], Alpha).GetSafeNormal();
+}
+
+FVector ARoombaBase::AdvanceAlongPath(float Distance)
+{
+	PathDistance += Distance;
+	if (bIsPathClosed && PathLength > 0)
+	{
+		PathDistance = FMath::Fmod(PathDistance, PathLength);
+		if (PathDistance < 0)
+			PathDistance += PathLength;
+	}
+	else
+		PathDistance = FMath::Clamp(PathDistance, 0.f, PathLength);
 
+	return GetPathLocationAtDistance(PathDistance);
 }
 
 void ARoombaBase::OnInteract_Implementation(ASpeegyptCharacter* Player)
 {
-	if (Player)
+	if (Player && Vessel->IsStateAllowed(Player->RightVessel->GetVesselState()) && Player->RightVessel->IsStateAllowed(Vessel->GetVesselState()))
 	{
 		EVesselState TempState = Vessel->GetVesselState();
 		Vessel->SetVesselState(Player->RightVessel->GetVesselState());
@@ -32,14 +32,56 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintREadWrite)
 	float LightCooldown = 0.0f;
 
+	/// How close the player has to be before this roomba notices them. See URoombaSensingSubsystem.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensing")
+	float PlayerSenseRange = 1500.f;
+
+	/// Distance between the samples of the path lookup table. Smaller spacing follows tight corners more closely.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Path")
+	float PathSampleSpacing = 25.f;
+
+	/// How far along Path the roomba currently is, advanced by AdvanceAlongPath.
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Path")
+	float PathDistance = 0.f;
+
+	/// Rebuilds the lookup table from Path. Only needed if the spline is changed after BeginPlay.
+	UFUNCTION(BlueprintCallable, Category = "Path")
+	void RebuildPathTable();
+
+	UFUNCTION(BlueprintPure, Category = "Path")
+	float GetPathLength() const { return PathLength; }
+
+	/// Returns the world location at the given distance along Path. Wraps around on closed paths and clamps on open ones.
+	UFUNCTION(BlueprintPure, Category = "Path")
+	FVector GetPathLocationAtDistance(float Distance) const;
+
+	/// Returns the world direction of travel at the given distance along Path.
+	UFUNCTION(BlueprintPure, Category = "Path")
+	FVector GetPathDirectionAtDistance(float Distance) const;
+
+	/// Moves PathDistance on by the given distance and returns the location there, for behaviour tree tasks to move to.
+	UFUNCTION(BlueprintCallable, Category = "Path")
+	FVector AdvanceAlongPath(float Distance);
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// World locations and directions sampled every PathSampleSpacing along Path, so following it never evaluates the spline.
+	TArray<FVector> PathLocations;
+
+	TArray<FVector> PathDirections;
+
+	float PathLength = 0.f;
 
+	bool bIsPathClosed = false;
+
+	/// Turns a distance along the path into a sample index and the alpha towards the next sample.
+	void GetPathSample(float Distance, int32& OutIndex, float& OutAlpha) const;
+
+public:	
 	void OnInteract_Implementation(ASpeegyptCharacter* Player) override;
 
 };
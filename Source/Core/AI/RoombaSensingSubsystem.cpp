@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RoombaSensingSubsystem.h"
+#include "RoombaBase.h"
+#include "../Character/SpeegyptCharacter.h"
+#include "AIController.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+URoombaSensingSubsystem* URoombaSensingSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<URoombaSensingSubsystem>() : nullptr;
+}
+
+void URoombaSensingSubsystem::Register(ARoombaBase* Roomba)
+{
+	if (!Roomba)
+		return;
+
+	Roombas.AddUnique(Roomba);
+
+	if (!SenseTimer.IsValid())
+		GetWorld()->GetTimerManager().SetTimer(SenseTimer, this, &URoombaSensingSubsystem::Sense, SenseInterval, true);
+}
+
+void URoombaSensingSubsystem::Unregister(ARoombaBase* Roomba)
+{
+	Roombas.RemoveSingleSwap(Roomba);
+
+	if (!Roombas.Num())
+		GetWorld()->GetTimerManager().ClearTimer(SenseTimer);
+}
+
+void URoombaSensingSubsystem::Deinitialize()
+{
+	Roombas.Empty();
+
+	Super::Deinitialize();
+}
+
+void URoombaSensingSubsystem::Sense()
+{
+	UWorld* World = GetWorld();
+	ASpeegyptCharacter* Player = Cast<ASpeegyptCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0));
+
+	// Everything about the player is worked out once and shared by every roomba.
+	FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+	FVector PlayerEyes = Player ? Player->GetPawnViewLocation() : FVector::ZeroVector;
+	EVesselState PlayerState = Player && Player->RightVessel ? Player->RightVessel->GetVesselState() : EVesselState::Unequipped;
+	bool bPlayerHasLight = PlayerState != EVesselState::Empty && PlayerState != EVesselState::Unequipped;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(RoombaSensing), true);
+
+	for (ARoombaBase* Roomba : Roombas)
+	{
+		if (!Roomba)
+			continue;
+
+		AAIController* Controller = Cast<AAIController>(Roomba->GetController());
+		UBlackboardComponent* Blackboard = Controller ? Controller->GetBlackboardComponent() : nullptr;
+		if (!Blackboard)
+			continue;
+
+		float Distance = Player ? FVector::Dist(Roomba->GetActorLocation(), PlayerLocation) : BIG_NUMBER;
+		bool bInRange = Distance <= Roomba->PlayerSenseRange;
+
+		// Line of sight is the only per roomba query, and only roombas that could notice the player pay for it.
+		bool bCanSee = false;
+		if (Player && bInRange)
+		{
+			Params.ClearIgnoredActors();
+			Params.AddIgnoredActor(Player);
+			Params.AddIgnoredActor(Roomba);
+			bCanSee = !World->LineTraceTestByChannel(Roomba->GetPawnViewLocation(), PlayerEyes, ECollisionChannel::ECC_Visibility, Params);
+		}
+
+		Blackboard->SetValueAsVector(PlayerLocationKey, PlayerLocation);
+		Blackboard->SetValueAsFloat(PlayerDistanceKey, Distance);
+		Blackboard->SetValueAsBool(IsPlayerInRangeKey, bInRange);
+		Blackboard->SetValueAsBool(CanSeePlayerKey, bCanSee);
+		Blackboard->SetValueAsBool(PlayerHasLightKey, bPlayerHasLight);
+		Blackboard->SetValueAsBool(IsLightOnCooldownKey, Roomba->LightCooldown > 0);
+	}
+}
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RoombaSensingSubsystem.generated.h"
+
+class ARoombaBase;
+
+/// Senses the player on behalf of every roomba in the world. Once every SenseInterval the player is looked up once, then
+/// each registered roomba gets its distance, line of sight and the player's light state written to its blackboard in one
+/// pass, so behaviour tree tasks read keys instead of querying the player themselves.
+UCLASS()
+class SPEEGYPT_API URoombaSensingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// Returns the subsystem of the given world, or nullptr if there isn't one.
+	static URoombaSensingSubsystem* Get(const UWorld* World);
+
+	void Register(ARoombaBase* Roomba);
+
+	void Unregister(ARoombaBase* Roomba);
+
+	/// Seconds between sensing passes.
+	float SenseInterval = 0.2f;
+
+	/// Blackboard keys the results are written to. Keys missing from a roomba's blackboard are skipped.
+	/// They are kept apart from IsPlayerInRange, CanSeePlayer and PlayerHasLight, which the BB_Roomba tasks write with their own rules.
+	FName PlayerLocationKey = TEXT("PlayerLocation");
+
+	FName PlayerDistanceKey = TEXT("PlayerDistance");
+
+	FName IsPlayerInRangeKey = TEXT("SensedPlayerInRange");
+
+	FName CanSeePlayerKey = TEXT("SensedCanSeePlayer");
+
+	FName PlayerHasLightKey = TEXT("SensedPlayerHasLight");
+
+	FName IsLightOnCooldownKey = TEXT("IsLightOnCooldown");
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	UPROPERTY()
+	TArray<ARoombaBase*> Roombas;
+
+	FTimerHandle SenseTimer;
+
+	/// Senses the player once and writes the results to every registered roomba's blackboard.
+	void Sense();
+};
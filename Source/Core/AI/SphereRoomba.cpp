@@ -6,8 +6,6 @@
 // Sets default values
 ASphereRoomba::ASphereRoomba()
 {
- 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
 	Vessel->SetEffectShapeType(EEffectShapeType::Sphere);
 }
 
@@ -17,10 +15,3 @@ void ASphereRoomba::BeginPlay()
 	Super::BeginPlay();
 	
 }
-
-// Called every frame
-void ASphereRoomba::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
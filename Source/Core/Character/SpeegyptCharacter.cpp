@@ -8,6 +8,7 @@
 #include "GameFramework/InputSettings.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "../HelperFiles/DefinedDebugHelpers.h"
 #include "../Interactables/Interactable.h"
@@ -55,14 +56,11 @@ ASpeegyptCharacter::ASpeegyptCharacter()
 	RightVessel->SetupAttachment(Mesh1P);
 
 	// makes it so the effect sphere of the effects is centered on the player, not the vessel in their hand.
-	RightVessel->Effects.CyanEffect->SetupAttachment(GetCapsuleComponent());
-	RightVessel->Effects.MagentaEffect->SetupAttachment(GetCapsuleComponent());
-	RightVessel->Effects.YellowEffect->SetupAttachment(GetCapsuleComponent());
-	RightVessel->Effects.VioletEffect->SetupAttachment(GetCapsuleComponent());
+	RightVessel->EffectAttachParent = GetCapsuleComponent();
 
-	RightVessel->Effects.LimeEffect->HitCone->SetupAttachment(this->Mesh1P);
+	RightVessel->HitConeAttachParent = Mesh1P;
 
-	RightVessel->Effects.CyanEffect->ForceMagnitude = 100;
+	RightVessel->CyanForceMagnitude = 100;
 
 	RightVessel->SetEffectShapeType(EEffectShapeType::Sphere);
 
@@ -79,6 +77,8 @@ ASpeegyptCharacter::ASpeegyptCharacter()
 	HeldObjectPosition = CreateDefaultSubobject<USceneComponent>(TEXT("HeldObjectPosition"));
 	HeldObjectPosition->SetupAttachment(Mesh1P);
 	HeldObjectPosition->SetRelativeLocation(FVector(80, 0, 150));
+
+	PhysicsHandle = CreateDefaultSubobject<UPhysicsHandleComponent>(TEXT("PhysicsHandle"));
 }
 
 void ASpeegyptCharacter::BeginPlay()
@@ -89,10 +89,6 @@ void ASpeegyptCharacter::BeginPlay()
 	{
 		World = GetWorld();
 	}
-	// trying to optimize ticks
-	RightVessel->Effects.CyanEffect->Disable();
-	RightVessel->Effects.MagentaEffect->Disable();
-	RightVessel->Effects.YellowEffect->Disable();
 	RightVessel->SetVesselState(RightVessel->GetVesselState());
 
 }
@@ -101,6 +97,11 @@ void ASpeegyptCharacter::Tick(float DeltaTime)
 {
 	if (bIncrimentInteractHoldTimer && InteractHoldTimer < 0.3)
 		InteractHoldTimer += DeltaTime;
+
+	UpdateFocus();
+
+	if (PhysicsHandle->GetGrabbedComponent())
+		PhysicsHandle->SetTargetLocationAndRotation(HeldObjectPosition->GetComponentLocation(), HeldObjectPosition->GetComponentRotation());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -183,22 +184,10 @@ void ASpeegyptCharacter::OnInteractReleased()
 
 void ASpeegyptCharacter::OnInteractBegin()
 {
-	FHitResult Hit;
-	FVector Position = FirstPersonCameraComponent->GetComponentLocation();
-	FVector Forward = FirstPersonCameraComponent->GetForwardVector();
-	//DEBUGL(Position, InteractDist * Forward + Position, false); // Debug
-	if (World->SweepSingleByChannel(Hit,
-		Position,
-		InteractDist * Forward + Position,
-		GetActorRotation().Quaternion(),
-		ECollisionChannel::ECC_GameTraceChannel2, // InteractTrace
-		FCollisionShape::MakeSphere(InteractRadius)))
-	{
-		//SCREENMSG(Hit.Actor->GetName()); // Debug
-		IInteractable* PureActor = Cast<IInteractable>(Hit.Actor);
-		if(PureActor)
-			PureActor->Execute_OnInteract(Cast<AActor>(Hit.Actor), this);
-	}
+	// The cached focus can be a whole update old, so make sure the player is still looking at it
+	AActor* Focused = GetValidFocus(false);
+	if (Focused)
+		IInteractable::Execute_OnInteract(Focused, this);
 }
 
 void ASpeegyptCharacter::OnGrabBegin()
@@ -209,23 +198,79 @@ void ASpeegyptCharacter::OnGrabBegin()
 		return;
 	}
 
+	IGrabbableObject* ObjectToGrab = Cast<IGrabbableObject>(GetValidFocus(true));
+	if (ObjectToGrab)
+		GrabObject(ObjectToGrab);
+}
+
+void ASpeegyptCharacter::UpdateFocus()
+{
+	float Time = GetWorld()->GetTimeSeconds();
+	if (LastFocusTime >= 0 && Time - LastFocusTime < FocusUpdateInterval)
+		return;
+	LastFocusTime = Time;
+
+	bool bGrabbable = bFocusGrabbableNext;
+	bFocusGrabbableNext = !bFocusGrabbableNext;
+	SweepFocus(bGrabbable);
+}
+
+AActor* ASpeegyptCharacter::SweepFocus(bool bGrabbable)
+{
+	FCollisionQueryParams Params;
+	Params.AddIgnoredActor(this);
+	if (HeldObject)
+		Params.AddIgnoredActor(Cast<AActor>(HeldObject->_getUObject()));
+
 	FHitResult Hit;
 	FVector Position = FirstPersonCameraComponent->GetComponentLocation();
 	FVector Forward = FirstPersonCameraComponent->GetForwardVector();
 	//DEBUGL(Position, InteractDist * Forward + Position, false); // Debug
-	if (World->SweepSingleByChannel(Hit,
+	bool bHit = GetWorld()->SweepSingleByChannel(Hit,
 		Position,
 		InteractDist * Forward + Position,
 		GetActorRotation().Quaternion(),
-		ECollisionChannel::ECC_Visibility, // InteractTrace
-		FCollisionShape::MakeSphere(InteractRadius)))
+		bGrabbable ? ECollisionChannel::ECC_Visibility : ECollisionChannel::ECC_GameTraceChannel2, // InteractTrace
+		FCollisionShape::MakeSphere(InteractRadius),
+		Params);
+
+	AActor* HitActor = bHit ? Hit.GetActor() : nullptr;
+	USceneComponent* HitComponent = bHit ? Hit.GetComponent() : nullptr;
+	FVector HitPoint = HitComponent ? HitComponent->GetComponentTransform().InverseTransformPosition(Hit.ImpactPoint) : FVector::ZeroVector;
+	if (bGrabbable)
 	{
-		IGrabbableObject* ObjectToGrab = Cast<IGrabbableObject>(Hit.Actor);
-		if (ObjectToGrab)
-		{
-			GrabObject(ObjectToGrab);
-		}
+		FocusedGrabbable = Cast<IGrabbableObject>(HitActor) ? HitActor : nullptr;
+		FocusedGrabbableComponent = HitComponent;
+		FocusedGrabbablePoint = HitPoint;
+		return FocusedGrabbable.Get();
 	}
+
+	FocusedInteractable = HitActor && HitActor->Implements<UInteractable>() ? HitActor : nullptr;
+	FocusedInteractableComponent = HitComponent;
+	FocusedInteractablePoint = HitPoint;
+	return FocusedInteractable.Get();
+}
+
+AActor* ASpeegyptCharacter::GetValidFocus(bool bGrabbable)
+{
+	AActor* Focused = bGrabbable ? FocusedGrabbable.Get() : FocusedInteractable.Get();
+	USceneComponent* Component = bGrabbable ? FocusedGrabbableComponent.Get() : FocusedInteractableComponent.Get();
+	FVector LocalPoint = bGrabbable ? FocusedGrabbablePoint : FocusedInteractablePoint;
+
+	if (Focused && !Focused->IsPendingKill() && Component)
+	{
+		FVector ToFocus = Component->GetComponentTransform().TransformPosition(LocalPoint) - FirstPersonCameraComponent->GetComponentLocation();
+		float Reach = InteractDist + InteractRadius;
+		bool bInReach = ToFocus.SizeSquared() <= Reach * Reach;
+		bool bInCone = FVector::DotProduct(ToFocus.GetSafeNormal(), FirstPersonCameraComponent->GetForwardVector()) >= FMath::Cos(FMath::DegreesToRadians(FocusConeAngle));
+		if (bInReach && bInCone)
+			return Focused;
+	}
+
+	// Out of date, the next update sweeps for this focus instead of waiting its turn
+	LastFocusTime = -1;
+	bFocusGrabbableNext = bGrabbable;
+	return nullptr;
 }
 
 void ASpeegyptCharacter::AimAbility()
@@ -252,6 +297,11 @@ void ASpeegyptCharacter::GrabObject(IGrabbableObject* ObjectToGrab)
 {
 	if (!HeldObject && ObjectToGrab)
 	{
+		// Objects the Violet effect is about to swap or move stay where they are until the swap commits
+		UVioletVesselEffect* VioletEffect = RightVessel ? RightVessel->Effects.VioletEffect : nullptr;
+		if (VioletEffect && VioletEffect->IsActorReserved(Cast<AActor>(ObjectToGrab->_getUObject())))
+			return;
+
 		if (ObjectToGrab->OnGrabBegin(this))
 			HeldObject = ObjectToGrab;
 	}
@@ -9,6 +9,7 @@
 
 class UInputComponent;
 class IGrabbableObject;
+class UPhysicsHandleComponent;
 
 UCLASS(config=Game)
 class ASpeegyptCharacter : public ACharacter
@@ -53,12 +54,35 @@ class ASpeegyptCharacter : public ACharacter
 	UPROPERTY()
 	TEnumAsByte<ECollisionResponse> HeldObjectDefaultCollision;
 
+	/// Interactable and grabbable actors under the crosshair, refreshed by UpdateFocus.
+	TWeakObjectPtr<AActor> FocusedInteractable;
+
+	TWeakObjectPtr<AActor> FocusedGrabbable;
+
+	/// Component each focus sweep hit and where, in that component's space, so a press can check the focus is still in front of the player.
+	TWeakObjectPtr<USceneComponent> FocusedInteractableComponent;
+
+	TWeakObjectPtr<USceneComponent> FocusedGrabbableComponent;
+
+	FVector FocusedInteractablePoint = FVector::ZeroVector;
+
+	FVector FocusedGrabbablePoint = FVector::ZeroVector;
+
+	float LastFocusTime = -1;
+
+	/// Which of the two focus sweeps UpdateFocus does next. They take turns, so there is never more than one per update.
+	bool bFocusGrabbableNext = false;
+
 public:
 	ASpeegyptCharacter();
 
 	UPROPERTY(VisibleAnywhere)
 	USceneComponent* HeldObjectPosition;
 
+	/// Carries simulating objects towards HeldObjectPosition without taking them out of the physics scene.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	UPhysicsHandleComponent* PhysicsHandle;
+
 	IGrabbableObject* HeldObject;
 
 protected:
@@ -90,6 +114,22 @@ public:
 	UFUNCTION(BlueprintCallable)
 	int GetCurrentHealth() { return Health; };
 
+	/// Seconds between focus sweeps. Each sweep refreshes either the interactable or the grabbable focus.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float FocusUpdateInterval = 1.f / 30.f;
+
+	/// Half angle in degrees of the view cone a cached focus has to be inside for a press to act on it.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float FocusConeAngle = 20.f;
+
+	/** Returns the interactable actor the player is looking at, or nullptr */
+	UFUNCTION(BlueprintCallable)
+	AActor* GetFocusedInteractable() const { return FocusedInteractable.Get(); };
+
+	/** Returns the grabbable actor the player is looking at, or nullptr */
+	UFUNCTION(BlueprintCallable)
+	AActor* GetFocusedGrabbable() const { return FocusedGrabbable.Get(); };
+
 protected:
 
 	/** Handles moving forward/backward */
@@ -117,6 +157,16 @@ protected:
 	void OnInteractBegin();
 
 	void OnGrabBegin();
+
+	/// Sweeps for whatever the player is looking at, at most once every FocusUpdateInterval.
+	void UpdateFocus();
+
+	/// Sweeps from the camera for a grabbable or an interactable actor and updates the matching focus. Returns the actor found, or nullptr.
+	AActor* SweepFocus(bool bGrabbable);
+
+	/// Returns the cached focus if it still exists, is within reach and is inside FocusConeAngle. Otherwise returns nullptr and
+	/// makes the next UpdateFocus sweep for it straight away.
+	AActor* GetValidFocus(bool bGrabbable);
 	
 	virtual void AimAbility();
 
@@ -2,7 +2,9 @@
 
 
 #include "Vessel.h"
+#include "VesselColorRegistry.h"
 #include "UObject/ConstructorHelpers.h"
+#include "UObject/UObjectHash.h"
 
 // Sets default values for this component's properties
 UVessel::UVessel()
@@ -19,79 +21,13 @@ UVessel::UVessel()
 
 	//VesselMesh->SetWorldScale3D(FVector(0.25, 0.25, 0.25));
 
-	// Material Setup
-	static ConstructorHelpers::FObjectFinder<UMaterial> EmptyMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_EmptyVessel.MAT_EmptyVessel'"));
-	if (EmptyMatFinder.Object)
-	{
-		EmptyMat = EmptyMatFinder.Object;
-		VesselMesh->SetMaterial(0, EmptyMat);
-		VesselMesh->SetReceivesDecals(false);
-	}
-	static ConstructorHelpers::FObjectFinder<UMaterial> CyanMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_CyanLight.MAT_CyanLight'"));
-	if (CyanMatFinder.Object)
-		CyanMat = CyanMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> MagentaMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_MagentaLight.MAT_MagentaLight'"));
-	if (MagentaMatFinder.Object)
-		MagentaMat = MagentaMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> YellowMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_YellowLight.MAT_YellowLight'"));
-	if (YellowMatFinder.Object)
-		YellowMat = YellowMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> LimeMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_LimeLight.MAT_LimeLight'"));
-	if (LimeMatFinder.Object)
-		LimeMat = LimeMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> OrangeMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_OrangeLight.MAT_OrangeLight'"));
-	if (OrangeMatFinder.Object)
-		OrangeMat = OrangeMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> VioletMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_VioletLight.MAT_VioletLight'"));
-	if (VioletMatFinder.Object)
-		VioletMat = VioletMatFinder.Object;
-	static ConstructorHelpers::FObjectFinder<UMaterial> WhiteMatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_WhiteLight.MAT_WhiteLight'"));
-	if (WhiteMatFinder.Object)
-		WhiteMat = WhiteMatFinder.Object;
-
-	// Effect setup
-	CurrentVesselEffect = CreateDefaultSubobject<UVesselEffects>(TEXT("CurrentEffect"));
+	// The materials come from the UVesselColorRegistry once the vessel registers.
+	VesselMesh->SetReceivesDecals(false);
+
+	// Effect setup, the remaining effects are created by GetEffect() the first time they are needed.
 	Effects.EmptyEffect = CreateDefaultSubobject<UEmptyVesselEffect>(TEXT("EmptyEffect"));
-	Effects.CyanEffect = CreateDefaultSubobject<UCyanVesselEffect>(TEXT("CyanEffect"));
-	Effects.MagentaEffect = CreateDefaultSubobject<UMagentaVesselEffect>(TEXT("MagentaEffect"));
-	Effects.YellowEffect = CreateDefaultSubobject<UYellowVesselEffect>(TEXT("YellowEffect"));
-	Effects.LimeEffect = CreateDefaultSubobject<ULimeVesselEffect>(TEXT("LimeEffect"));
-	Effects.OrangeEffect = CreateDefaultSubobject<UOrangeVesselEffect>(TEXT("OrangeEffect"));
-	Effects.VioletEffect = CreateDefaultSubobject<UVioletVesselEffect>(TEXT("VioletEffect"));
-	Effects.WhiteEffect = CreateDefaultSubobject<UWhiteVesselEffect>(TEXT("WhiteEffect"));
-
-	CurrentVesselEffect->SetupAttachment(VesselMesh);
 	Effects.EmptyEffect->SetupAttachment(VesselMesh);
-	Effects.CyanEffect->SetupAttachment(VesselMesh);
-	Effects.MagentaEffect->SetupAttachment(VesselMesh);
-	Effects.YellowEffect->SetupAttachment(VesselMesh);
-	Effects.LimeEffect->SetupAttachment(VesselMesh);
-	Effects.OrangeEffect->SetupAttachment(VesselMesh);
-	Effects.VioletEffect->SetupAttachment(VesselMesh);
-	Effects.WhiteEffect->SetupAttachment(VesselMesh);
-	
-	// Attaches capsule components from UPassiveVesselEffect to their own corresponding effect. Out of place and weird,
-	// ... see if theres a more elegant solution.
-	Effects.CyanEffect->EffectShape->SetupAttachment(Effects.CyanEffect);
-	Effects.MagentaEffect->EffectShape->SetupAttachment(Effects.MagentaEffect);
-	Effects.YellowEffect->EffectShape->SetupAttachment(Effects.YellowEffect);
-	Effects.LimeEffect->HitCone->SetupAttachment(Effects.LimeEffect);
-	Effects.VioletEffect->CaptureCapsule->SetupAttachment(Effects.VioletEffect);
-
-	Effects.LimeEffect->HitCone->SetRelativeLocation(FVector(210, 80, 0));
-	Effects.LimeEffect->HitCone->SetWorldRotation(FRotator(90, 20, 0));
-	
-	if (GetOwner())
-	{
-		// this allows these components values to be edited in the details panel of the owning actor.
-		GetOwner()->AddInstanceComponent(Effects.CyanEffect);
-		GetOwner()->AddInstanceComponent(Effects.MagentaEffect);
-		GetOwner()->AddInstanceComponent(Effects.YellowEffect);
-		GetOwner()->AddInstanceComponent(Effects.LimeEffect);
-		GetOwner()->AddInstanceComponent(Effects.OrangeEffect);
-		GetOwner()->AddInstanceComponent(Effects.VioletEffect);
-		GetOwner()->AddInstanceComponent(Effects.WhiteEffect);
-	}
+	CurrentVesselEffect = Effects.EmptyEffect;
 
 	VesselState = EVesselState::Empty;
 }
@@ -102,20 +38,28 @@ void UVessel::BeginPlay()
 {
 	Super::BeginPlay();
 
-	Effects.CyanEffect->Disable();
-	Effects.MagentaEffect->Disable();
-	Effects.YellowEffect->Disable();
-	Effects.LimeEffect->Disable();
-	Effects.OrangeEffect->Disable();
-	Effects.VioletEffect->Disable();
-	Effects.WhiteEffect->Disable();
+	if (!IsStateAllowed(VesselState))
+		VesselState = EVesselState::Empty;
 
 	StateToChangeTo = VesselState;
 	ChangeState();
+}
 
-	Effects.CyanEffect->EffectShape->OnStartGrowing.AddDynamic(this, &UVessel::OnShapeStartGrowing);
-	Effects.MagentaEffect->EffectShape->OnStartGrowing.AddDynamic(this, &UVessel::OnShapeStartGrowing);
-	Effects.YellowEffect->EffectShape->OnStartGrowing.AddDynamic(this, &UVessel::OnShapeStartGrowing);
+void UVessel::OnRegister()
+{
+	Super::OnRegister();
+
+	const UVesselColorRegistry* Registry = UVesselColorRegistry::Get();
+	EmptyMat = Registry->GetVesselMaterial(EVesselState::Empty);
+	CyanMat = Registry->GetVesselMaterial(EVesselState::Cyan);
+	MagentaMat = Registry->GetVesselMaterial(EVesselState::Magenta);
+	YellowMat = Registry->GetVesselMaterial(EVesselState::Yellow);
+	LimeMat = Registry->GetVesselMaterial(EVesselState::Lime);
+	OrangeMat = Registry->GetVesselMaterial(EVesselState::Orange);
+	VioletMat = Registry->GetVesselMaterial(EVesselState::Violet);
+	WhiteMat = Registry->GetVesselMaterial(EVesselState::White);
+
+	UpdateColor();
 }
 
 // Called every frame
@@ -141,7 +85,7 @@ EVesselState UVessel::GetVesselState()
 
 void UVessel::SetVesselState(EVesselState NewState)
 {
-	if (VesselState == NewState)
+	if (VesselState == NewState || !IsStateAllowed(NewState))
 		return;
 
 	StateToChangeTo = NewState;
@@ -164,127 +108,243 @@ void UVessel::ChangeState()
 	CurrentVesselEffect->Disable();
 
 	VesselState = StateToChangeTo;
-	switch (VesselState)
+	UVesselEffects* NewEffect = GetOrCreateEffect(VesselState);
+	CurrentVesselEffect = NewEffect ? NewEffect : Effects.EmptyEffect;
+
+	UPassiveVesselEffect* PassiveEffect = Cast<UPassiveVesselEffect>(CurrentVesselEffect);
+	if (PassiveEffect)
+		PassiveEffect->EffectShape->StartSwap(true);
+
+	CurrentVesselEffect->Enable();
+	UpdateColor();
+
+	OnStateChange.Broadcast();
+}
+
+bool UVessel::IsStateAllowed(EVesselState State) const
+{
+	return State == EVesselState::Empty || State == EVesselState::Unequipped || (AllowedStates & (1 << (int32)State));
+}
+
+UVesselEffects* UVessel::GetEffect(EVesselState State) const
+{
+	if (!IsStateAllowed(State))
+		return nullptr;
+
+	UVesselEffects* Effect = nullptr;
+	switch (State)
 	{
 	case EVesselState::Empty:
-		CurrentVesselEffect = Effects.EmptyEffect;
-		VesselMesh->SetMaterial(0, EmptyMat);
+		Effect = Effects.EmptyEffect;
 		break;
 	case EVesselState::Cyan:
-		CurrentVesselEffect = Effects.CyanEffect;
-		Cast<UPassiveVesselEffect>(CurrentVesselEffect)->EffectShape->StartSwap(true);
+		Effect = Effects.CyanEffect;
 		break;
 	case EVesselState::Magenta:
-		CurrentVesselEffect = Effects.MagentaEffect;
-		Cast<UPassiveVesselEffect>(CurrentVesselEffect)->EffectShape->StartSwap(true);
+		Effect = Effects.MagentaEffect;
 		break;
 	case EVesselState::Yellow:
-		CurrentVesselEffect = Effects.YellowEffect;
-		Cast<UPassiveVesselEffect>(CurrentVesselEffect)->EffectShape->StartSwap(true);
+		Effect = Effects.YellowEffect;
 		break;
 	case EVesselState::Lime:
-		CurrentVesselEffect = Effects.LimeEffect;
+		Effect = Effects.LimeEffect;
 		break;
 	case EVesselState::Orange:
-		CurrentVesselEffect = Effects.OrangeEffect;
+		Effect = Effects.OrangeEffect;
 		break;
 	case EVesselState::Violet:
-		CurrentVesselEffect = Effects.VioletEffect;
+		Effect = Effects.VioletEffect;
 		break;
 	case EVesselState::White:
-		CurrentVesselEffect = Effects.WhiteEffect;
+		Effect = Effects.WhiteEffect;
+		break;
+	default:
 		break;
 	}
-
-	CurrentVesselEffect->Enable();
-	UpdateColor();
-
-	OnStateChange.Broadcast();
+	return Effect;
 }
 
-void UVessel::AimAbility()
+UVesselEffects* UVessel::GetOrCreateEffect(EVesselState State)
 {
-	CurrentVesselEffect->Aim();
-}
+	UVesselEffects* Effect = GetEffect(State);
 
-void UVessel::FireAbility()
-{
-	CurrentVesselEffect->Fire();
-}
+	// An effect loaded from an older level isn't registered yet, it is set up the same way as a new one
+	if (IsStateAllowed(State) && (!Effect || !Effect->IsRegistered()) && State != EVesselState::Unequipped && GetWorld() && GetWorld()->IsGameWorld())
+		Effect = CreateEffect(State);
 
-void UVessel::ResetAbilityAim()
-{
-	CurrentVesselEffect->ResetAim();
+	return Effect;
 }
 
-void UVessel::ResetAbilityFire()
+// Effects used to be default subobjects, so a level saved before they were created on demand can still hold one under its old name.
+// That instance is reused so its per-instance settings survive. Otherwise the new effect is made from the old subobject of the
+// vessel's archetype, if a Blueprint saved one, so its class default overrides carry over.
+template<class T>
+static T* FindOrCreateEffect(UVessel* Vessel, const TCHAR* Name)
 {
-	CurrentVesselEffect->ResetFire();
+	UObject* Existing = StaticFindObjectFast(nullptr, Vessel, FName(Name));
+	T* Effect = Cast<T>(Existing);
+	if (Effect && !Effect->IsRegistered() && !Effect->IsPendingKill())
+		return Effect;
+
+	T* Template = nullptr;
+	for (UVessel* Archetype = Cast<UVessel>(Vessel->GetArchetype()); Archetype && !Template; Archetype = Cast<UVessel>(Archetype->GetArchetype()))
+		Template = Cast<T>(StaticFindObjectFast(T::StaticClass(), Archetype, FName(Name)));
+
+	FName EffectName = Existing ? MakeUniqueObjectName(Vessel, T::StaticClass(), FName(Name)) : FName(Name);
+	return NewObject<T>(Vessel, EffectName, RF_NoFlags, Template);
 }
 
-void UVessel::UpdateColor()
+UVesselEffects* UVessel::CreateEffect(EVesselState State)
 {
-	switch (VesselState)
+	USceneComponent* PassiveParent = EffectAttachParent ? EffectAttachParent : VesselMesh;
+	UVesselEffects* NewEffect = nullptr;
+
+	switch (State)
 	{
 	case EVesselState::Cyan:
-		if(CyanMat)
-			VesselMesh->SetMaterial(0, CyanMat);
+		Effects.CyanEffect = FindOrCreateEffect<UCyanVesselEffect>(this, TEXT("CyanEffect"));
+		Effects.CyanEffect->ForceMagnitude = CyanForceMagnitude;
+		Effects.CyanEffect->SetupAttachment(PassiveParent);
+		NewEffect = Effects.CyanEffect;
 		break;
 	case EVesselState::Magenta:
-		if(MagentaMat)
-			VesselMesh->SetMaterial(0, MagentaMat);
+		Effects.MagentaEffect = FindOrCreateEffect<UMagentaVesselEffect>(this, TEXT("MagentaEffect"));
+		Effects.MagentaEffect->SetupAttachment(PassiveParent);
+		NewEffect = Effects.MagentaEffect;
 		break;
 	case EVesselState::Yellow:
-		if(YellowMat)
-			VesselMesh->SetMaterial(0, YellowMat);
+		Effects.YellowEffect = FindOrCreateEffect<UYellowVesselEffect>(this, TEXT("YellowEffect"));
+		Effects.YellowEffect->SetupAttachment(PassiveParent);
+		NewEffect = Effects.YellowEffect;
 		break;
 	case EVesselState::Lime:
-		if(LimeMat)
-			VesselMesh->SetMaterial(0, LimeMat);
+		Effects.LimeEffect = FindOrCreateEffect<ULimeVesselEffect>(this, TEXT("LimeEffect"));
+		Effects.LimeEffect->SetupAttachment(VesselMesh);
+		Effects.LimeEffect->HitCone->SetupAttachment(HitConeAttachParent ? HitConeAttachParent : Effects.LimeEffect);
+		Effects.LimeEffect->HitCone->SetRelativeLocationAndRotation(FVector(210, 80, 0), FRotator(90, 20, 0));
+		NewEffect = Effects.LimeEffect;
 		break;
 	case EVesselState::Orange:
-		if(OrangeMat)
-			VesselMesh->SetMaterial(0, OrangeMat);
+		Effects.OrangeEffect = FindOrCreateEffect<UOrangeVesselEffect>(this, TEXT("OrangeEffect"));
+		Effects.OrangeEffect->SetupAttachment(VesselMesh);
+		NewEffect = Effects.OrangeEffect;
 		break;
 	case EVesselState::Violet:
-		if(VioletMat)
-			VesselMesh->SetMaterial(0, VioletMat);
+		Effects.VioletEffect = FindOrCreateEffect<UVioletVesselEffect>(this, TEXT("VioletEffect"));
+		Effects.VioletEffect->SetupAttachment(PassiveParent);
+		Effects.VioletEffect->CaptureCapsule->SetupAttachment(Effects.VioletEffect);
+		NewEffect = Effects.VioletEffect;
 		break;
 	case EVesselState::White:
-		if (WhiteMat)
-			VesselMesh->SetMaterial(0, WhiteMat);
+		Effects.WhiteEffect = FindOrCreateEffect<UWhiteVesselEffect>(this, TEXT("WhiteEffect"));
+		Effects.WhiteEffect->SetupAttachment(VesselMesh);
+		NewEffect = Effects.WhiteEffect;
 		break;
 	default:
-		break;
+		return nullptr;
+	}
+
+	UPassiveVesselEffect* PassiveEffect = Cast<UPassiveVesselEffect>(NewEffect);
+	if (PassiveEffect)
+	{
+		if (bHasEffectShapeScale)
+			PassiveEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(EffectShapeScale);
+		if (bHasEffectShapeType)
+			PassiveEffect->SetEffectShapeType(EffectShapeType);
+
+		UCapsuleEffectShape* Capsule = Cast<UCapsuleEffectShape>(PassiveEffect->GetPooledShape(EEffectShapeType::Capsule));
+		if (Capsule)
+			Capsule->SetMeshType(EffectCapsuleType);
+	}
+
+	// Subobjects of a component created at runtime aren't registered along with it, so every live component under the new effect is registered here.
+	NewEffect->RegisterComponent();
+	TArray<UObject*> Subobjects;
+	GetObjectsWithOuter(NewEffect, Subobjects);
+	for (auto& Subobject : Subobjects)
+	{
+		UActorComponent* Component = Cast<UActorComponent>(Subobject);
+		if (Component && !Component->IsRegistered() && !Component->IsPendingKill())
+			Component->RegisterComponent();
 	}
+
+	if (PassiveEffect)
+	{
+		TArray<UEffectShape*> Shapes;
+		PassiveEffect->GetPooledShapes(Shapes);
+		for (auto& Shape : Shapes)
+			Shape->OnStartGrowing.AddUniqueDynamic(this, &UVessel::OnShapeStartGrowing);
+	}
+
+	NewEffect->Disable();
+
+	return NewEffect;
+}
+
+void UVessel::AimAbility()
+{
+	CurrentVesselEffect->Aim();
+}
+
+void UVessel::FireAbility()
+{
+	CurrentVesselEffect->Fire();
+}
+
+void UVessel::ResetAbilityAim()
+{
+	CurrentVesselEffect->ResetAim();
+}
+
+void UVessel::ResetAbilityFire()
+{
+	CurrentVesselEffect->ResetFire();
+}
+
+void UVessel::UpdateColor()
+{
+	UMaterial* StateMat = UVesselColorRegistry::Get()->GetVesselMaterial(VesselState);
+	if (StateMat)
+		VesselMesh->SetMaterial(0, StateMat);
 }
 
 void UVessel::SetEffectShapeType(EEffectShapeType NewType)
 {
-	Effects.CyanEffect->SetEffectShapeType(NewType);
-	Effects.MagentaEffect->SetEffectShapeType(NewType);
-	Effects.YellowEffect->SetEffectShapeType(NewType);
+	EffectShapeType = NewType;
+	bHasEffectShapeType = true;
+
+	if (Effects.CyanEffect)
+		Effects.CyanEffect->SetEffectShapeType(NewType);
+	if (Effects.MagentaEffect)
+		Effects.MagentaEffect->SetEffectShapeType(NewType);
+	if (Effects.YellowEffect)
+		Effects.YellowEffect->SetEffectShapeType(NewType);
 }
 
 void UVessel::SetEffectCapsuleType(EEffectCapsuleType NewType)
 {
-	UCapsuleEffectShape* CyanCapsule = Cast<UCapsuleEffectShape>(Effects.CyanEffect->EffectShape);
-	UCapsuleEffectShape* MagentaCapsule = Cast<UCapsuleEffectShape>(Effects.MagentaEffect->EffectShape);
-	UCapsuleEffectShape* YellowCapsule = Cast<UCapsuleEffectShape>(Effects.YellowEffect->EffectShape);
+	EffectCapsuleType = NewType;
 
-	if (CyanCapsule && MagentaCapsule && YellowCapsule)
+	UPassiveVesselEffect* PassiveEffects[] = { Effects.CyanEffect, Effects.MagentaEffect, Effects.YellowEffect };
+	for (auto& PassiveEffect : PassiveEffects)
 	{
-		CyanCapsule->SetMeshType(NewType);
-		MagentaCapsule->SetMeshType(NewType);
-		YellowCapsule->SetMeshType(NewType);
+		UCapsuleEffectShape* Capsule = PassiveEffect ? Cast<UCapsuleEffectShape>(PassiveEffect->GetPooledShape(EEffectShapeType::Capsule)) : nullptr;
+		if (Capsule)
+			Capsule->SetMeshType(NewType);
 	}
 }
 
 void UVessel::SetEffectShapeScale(FVector NewScale)
 {
-	Effects.CyanEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
-	Effects.MagentaEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
-	Effects.YellowEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
+	EffectShapeScale = NewScale;
+	bHasEffectShapeScale = true;
+
+	if (Effects.CyanEffect)
+		Effects.CyanEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
+	if (Effects.MagentaEffect)
+		Effects.MagentaEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
+	if (Effects.YellowEffect)
+		Effects.YellowEffect->EffectShape->EffectShapeMesh->SetWorldScale3D(NewScale);
 }
 
 void UVessel::OnShapeStartGrowing()
@@ -300,7 +360,11 @@ void UVessel::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 	//SCREENMSG(PropertyChangedEvent.GetPropertyName().ToString());
 
 	if (PropertyChangedEvent.GetPropertyName() == "VesselState")
+	{
 		SetVesselState(VesselState); // this should fix emms bug
+		UpdateColor();
+		OnStateChange.Broadcast();
+	}
 	else if (PropertyChangedEvent.GetPropertyName() == "EffectCapsuleType")
 		SetEffectCapsuleType(EffectCapsuleType);
 }
@@ -23,6 +23,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FVesselStateChangedDelegate);
 
 
 /// Struct containing the various effects used by a UVessel. This is done to prevent unintentional garbage collection of these effects.
+/// Only EmptyEffect is created up front, the rest are created by UVessel::GetEffect the first time their state is used.
 USTRUCT(BlueprintType)
 struct FVesselEffectTypes
 {
@@ -60,7 +61,7 @@ class SPEEGYPT_API UVessel : public USceneComponent
 	GENERATED_BODY()
 
 public:	
-	/// Sets up the vessel effects and their attachments, as well as the vessel's mesh and material.
+	/// Sets up the empty vessel effect, as well as the vessel's mesh and empty material. All other effects are created on first use.
 	UVessel();
 
 	/// Mesh used to render this vessel.
@@ -79,6 +80,22 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	FVesselEffectTypes Effects;
 
+	/// Bitmask of the vessel states this vessel is allowed to hold. Effects are never created for states outside of this mask.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Bitmask, BitmaskEnum = "EVesselState"))
+	int32 AllowedStates = -1;
+
+	/// Force magnitude given to the cyan effect when it is created.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float CyanForceMagnitude = 0.0f;
+
+	/// Component the passive and violet effects are attached to when they are created. Falls back to VesselMesh when null.
+	UPROPERTY()
+	USceneComponent* EffectAttachParent;
+
+	/// Component the lime hit cone is attached to when it is created. Falls back to the lime effect when null.
+	UPROPERTY()
+	USceneComponent* HitConeAttachParent;
+
 	/// Polymorphic pointer used to cleanly store which vessel effect is currently active.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UVesselEffects* CurrentVesselEffect;
@@ -86,28 +103,29 @@ public:
 	UPROPERTY()
 	FVesselStateChangedDelegate OnStateChange;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	/// Deprecated, the vessel materials now come from the UVesselColorRegistry. Filled from it when the vessel registers, for Blueprints that still read them.
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* EmptyMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* CyanMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* MagentaMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* YellowMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* LimeMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* OrangeMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* VioletMat;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Material")
+	UPROPERTY(BlueprintReadOnly, Category = "Material", meta = (DeprecatedProperty, DeprecationMessage = "Use the Vessel Colors project settings instead."))
 	UMaterial* WhiteMat;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
@@ -142,6 +160,14 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetVesselState(EVesselState NewState);
 
+	/// Returns true if the given state is part of AllowedStates.
+	UFUNCTION(BlueprintCallable)
+	bool IsStateAllowed(EVesselState State) const;
+
+	/// Returns the effect used by the given state, or null if it hasn't been created yet or the state isn't allowed.
+	UFUNCTION(BlueprintPure)
+	UVesselEffects* GetEffect(EVesselState State) const;
+
 	/// Used to aim the current effects ability.
 	UFUNCTION()
 	void AimAbility();
@@ -158,7 +184,7 @@ public:
 	UFUNCTION()
 	void ResetAbilityFire();
 
-	/// Helper function to update the material based on the current vessel state.
+	/// Helper function to update the material based on the current vessel state. Materials come from the shared UVesselColorRegistry.
 	UFUNCTION(BlueprintCallable)
 	void UpdateColor();
 
@@ -179,9 +205,31 @@ protected:
 	UPROPERTY()
 	EVesselState StateToChangeTo;
 
+	/// Shape settings applied to passive effects as they are created.
+	UPROPERTY()
+	EEffectShapeType EffectShapeType;
+
+	UPROPERTY()
+	bool bHasEffectShapeType = false;
+
+	UPROPERTY()
+	FVector EffectShapeScale;
+
+	UPROPERTY()
+	bool bHasEffectShapeScale = false;
+
+	/// Returns the effect used by the given state, creating and registering it the first time it is needed in a game world.
+	UVesselEffects* GetOrCreateEffect(EVesselState State);
+
+	/// Creates the effect for the given state, applies the vessel's attachment and shape settings to it, then registers it and its subobjects.
+	UVesselEffects* CreateEffect(EVesselState State);
+
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Fills the deprecated material properties from the UVesselColorRegistry and applies the current state's material.
+	virtual void OnRegister() override;
+
 	UFUNCTION()
 	void ChangeState();
 
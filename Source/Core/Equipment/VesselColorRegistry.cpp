@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VesselColorRegistry.h"
+
+UVesselColorRegistry::UVesselColorRegistry()
+{
+	const TCHAR* DefaultGlow = TEXT("/Game/Speegypt/Effects/Materials/MAT_DefaultGlow_Inst.MAT_DefaultGlow_Inst");
+
+	AddColor(EVesselState::Empty, TEXT("/Game/Speegypt/Environment/Materials/MAT_EmptyVessel.MAT_EmptyVessel"), DefaultGlow, FLinearColor::White);
+	AddColor(EVesselState::Cyan, TEXT("/Game/Speegypt/Environment/Materials/MAT_CyanLight.MAT_CyanLight"), TEXT("/Game/Speegypt/Effects/Materials/MAT_CyanGlow_Inst.MAT_CyanGlow_Inst"), FLinearColor(0.265f, 0.56f, 0.847f));
+	AddColor(EVesselState::Magenta, TEXT("/Game/Speegypt/Environment/Materials/MAT_MagentaLight.MAT_MagentaLight"), TEXT("/Game/Speegypt/Effects/Materials/MAT_MagentaGlow_Inst.MAT_MagentaGlow_Inst"), FLinearColor(0.906f, 0.261f, 0.947f));
+	AddColor(EVesselState::Yellow, TEXT("/Game/Speegypt/Environment/Materials/MAT_YellowLight.MAT_YellowLight"), TEXT("/Game/Speegypt/Effects/Materials/MAT_YellowGlow_Inst.MAT_YellowGlow_Inst"), FLinearColor(0.875f, 0.93f, 0.237f));
+	AddColor(EVesselState::Lime, TEXT("/Game/Speegypt/Environment/Materials/MAT_LimeLight.MAT_LimeLight"), DefaultGlow, FLinearColor::White);
+	AddColor(EVesselState::Orange, TEXT("/Game/Speegypt/Environment/Materials/MAT_OrangeLight.MAT_OrangeLight"), DefaultGlow, FLinearColor::White);
+	AddColor(EVesselState::Violet, TEXT("/Game/Speegypt/Environment/Materials/MAT_VioletLight.MAT_VioletLight"), DefaultGlow, FLinearColor::White);
+	AddColor(EVesselState::White, TEXT("/Game/Speegypt/Environment/Materials/MAT_WhiteLight.MAT_WhiteLight"), DefaultGlow, FLinearColor::White);
+
+	ShapeMeshes.Add(EEffectShapeType::Box, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCube.SM_EffectsCube"))));
+	ShapeMeshes.Add(EEffectShapeType::Capsule, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule.SM_EffectsCapsule"))));
+	ShapeMeshes.Add(EEffectShapeType::Cone, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCone.SM_EffectsCone"))));
+	ShapeMeshes.Add(EEffectShapeType::Sphere, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsSphere.SM_EffectsSphere"))));
+
+	CapsuleMeshes.Add(EEffectCapsuleType::TwoToOne, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule.SM_EffectsCapsule"))));
+	CapsuleMeshes.Add(EEffectCapsuleType::ThreeToOne, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule_750_250.SM_EffectsCapsule_750_250"))));
+	CapsuleMeshes.Add(EEffectCapsuleType::EightToOne, TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule_800_100.SM_EffectsCapsule_800_100"))));
+
+	DecalMaterial = TSoftObjectPtr<UMaterial>(FSoftObjectPath(TEXT("/Game/Speegypt/Effects/Materials/MAT_DefaultDecal.MAT_DefaultDecal")));
+}
+
+const UVesselColorRegistry* UVesselColorRegistry::Get()
+{
+	UVesselColorRegistry* Registry = GetMutableDefault<UVesselColorRegistry>();
+	if (!Registry->bIsLoaded)
+		Registry->LoadAssets();
+
+	return Registry;
+}
+
+const FVesselColorAssets& UVesselColorRegistry::GetColor(EVesselState State) const
+{
+	static const FVesselColorAssets NoAssets;
+
+	const FVesselColorAssets* Assets = LoadedColors.Find(State);
+	if (!Assets)
+		Assets = LoadedColors.Find(EVesselState::Empty);
+
+	return Assets ? *Assets : NoAssets;
+}
+
+UMaterial* UVesselColorRegistry::GetVesselMaterial(EVesselState State) const
+{
+	const FVesselColorAssets* Assets = LoadedColors.Find(State);
+	return Assets ? Assets->VesselMaterial : nullptr;
+}
+
+UStaticMesh* UVesselColorRegistry::GetShapeMesh(EEffectShapeType Type) const
+{
+	UStaticMesh* const* Mesh = LoadedShapeMeshes.Find(Type);
+	return Mesh ? *Mesh : nullptr;
+}
+
+UStaticMesh* UVesselColorRegistry::GetCapsuleMesh(EEffectCapsuleType Type) const
+{
+	UStaticMesh* const* Mesh = LoadedCapsuleMeshes.Find(Type);
+	return Mesh ? *Mesh : nullptr;
+}
+
+UMaterial* UVesselColorRegistry::GetDecalMaterial() const
+{
+	return LoadedDecalMaterial;
+}
+
+FName UVesselColorRegistry::GetCategoryName() const
+{
+	return TEXT("Game");
+}
+
+void UVesselColorRegistry::LoadAssets()
+{
+	LoadedColors.Reset();
+	LoadedShapeMeshes.Reset();
+	LoadedCapsuleMeshes.Reset();
+
+	for (auto& Color : Colors)
+	{
+		FVesselColorAssets& Assets = LoadedColors.Add(Color.Key);
+		Assets.VesselMaterial = Color.Value.VesselMaterial.LoadSynchronous();
+		Assets.GlowMaterial = Color.Value.GlowMaterial.LoadSynchronous();
+		Assets.LightColor = Color.Value.LightColor;
+	}
+
+	for (auto& ShapeMesh : ShapeMeshes)
+		LoadedShapeMeshes.Add(ShapeMesh.Key, ShapeMesh.Value.LoadSynchronous());
+
+	for (auto& CapsuleMesh : CapsuleMeshes)
+		LoadedCapsuleMeshes.Add(CapsuleMesh.Key, CapsuleMesh.Value.LoadSynchronous());
+
+	LoadedDecalMaterial = DecalMaterial.LoadSynchronous();
+
+	bIsLoaded = true;
+}
+
+void UVesselColorRegistry::AddColor(EVesselState State, const TCHAR* VesselMaterial, const TCHAR* GlowMaterial, FLinearColor LightColor)
+{
+	FVesselColorEntry& Entry = Colors.Add(State);
+	Entry.VesselMaterial = TSoftObjectPtr<UMaterial>(FSoftObjectPath(VesselMaterial));
+	Entry.GlowMaterial = TSoftObjectPtr<UMaterialInstance>(FSoftObjectPath(GlowMaterial));
+	Entry.LightColor = LightColor;
+}
+
+#if WITH_EDITOR
+void UVesselColorRegistry::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	bIsLoaded = false;
+}
+#endif
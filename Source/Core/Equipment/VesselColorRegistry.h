@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstance.h"
+#include "VesselEnums.h"
+#include "VesselEffects/EffectShapes/CapsuleEffectShape.h"
+#include "VesselColorRegistry.generated.h"
+
+
+/// Assets and colours used to render a single vessel state. Edited through the project settings.
+USTRUCT(BlueprintType)
+struct FVesselColorEntry
+{
+	GENERATED_BODY()
+
+	/// Material used by the vessel mesh while in this state.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	TSoftObjectPtr<UMaterial> VesselMaterial;
+
+	/// Material used by the effect shape mesh while in this state.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	TSoftObjectPtr<UMaterialInstance> GlowMaterial;
+
+	/// Colour of the light given off by this state, also used as the decal colour.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	FLinearColor LightColor = FLinearColor::White;
+};
+
+/// Loaded version of FVesselColorEntry, kept by the registry so lookups never have to touch the asset registry.
+USTRUCT(BlueprintType)
+struct FVesselColorAssets
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	UMaterial* VesselMaterial = nullptr;
+
+	UPROPERTY(BlueprintReadOnly)
+	UMaterialInstance* GlowMaterial = nullptr;
+
+	UPROPERTY(BlueprintReadOnly)
+	FLinearColor LightColor = FLinearColor::White;
+};
+
+/// Project wide registry of the materials, meshes and colours used by vessels and their effects.
+/// The assets are loaded the first time the registry is asked for and shared by every vessel afterwards. It is the only place the
+/// effects get their materials, meshes and colours from, they are applied once the components register.
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Vessel Colors"))
+class SPEEGYPT_API UVesselColorRegistry : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/// Fills the registry with the assets the vessels have always used, so a project without any config still looks the same.
+	UVesselColorRegistry();
+
+	UPROPERTY(Config, EditAnywhere, Category = "Colors")
+	TMap<EVesselState, FVesselColorEntry> Colors;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Shapes")
+	TMap<EEffectShapeType, TSoftObjectPtr<UStaticMesh>> ShapeMeshes;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Shapes")
+	TMap<EEffectCapsuleType, TSoftObjectPtr<UStaticMesh>> CapsuleMeshes;
+
+	/// Material every effect shape decal is made from, tinted with the state's LightColor.
+	UPROPERTY(Config, EditAnywhere, Category = "Shapes")
+	TSoftObjectPtr<UMaterial> DecalMaterial;
+
+	/// Returns the registry with all of its assets loaded. Loads synchronously on first use, so never call it from a constructor.
+	static const UVesselColorRegistry* Get();
+
+	/// Returns the loaded assets for the given state. States without an entry fall back to the Empty entry.
+	const FVesselColorAssets& GetColor(EVesselState State) const;
+
+	UMaterial* GetVesselMaterial(EVesselState State) const;
+
+	UStaticMesh* GetShapeMesh(EEffectShapeType Type) const;
+
+	UStaticMesh* GetCapsuleMesh(EEffectCapsuleType Type) const;
+
+	UMaterial* GetDecalMaterial() const;
+
+	virtual FName GetCategoryName() const override;
+
+protected:
+
+	UPROPERTY(Transient)
+	TMap<EVesselState, FVesselColorAssets> LoadedColors;
+
+	UPROPERTY(Transient)
+	TMap<EEffectShapeType, UStaticMesh*> LoadedShapeMeshes;
+
+	UPROPERTY(Transient)
+	TMap<EEffectCapsuleType, UStaticMesh*> LoadedCapsuleMeshes;
+
+	UPROPERTY(Transient)
+	UMaterial* LoadedDecalMaterial = nullptr;
+
+	bool bIsLoaded = false;
+
+	/// Resolves every soft reference in the registry into the Loaded maps.
+	void LoadAssets();
+
+	void AddColor(EVesselState State, const TCHAR* VesselMaterial, const TCHAR* GlowMaterial, FLinearColor LightColor);
+
+#if WITH_EDITOR
+	/// Makes sure changes made in the project settings are picked up the next time the registry is used.
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
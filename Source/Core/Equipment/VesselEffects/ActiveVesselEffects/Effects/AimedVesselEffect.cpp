@@ -6,6 +6,7 @@
 #include "OrangeVesselEffect.h"
 #include "VioletVesselEffect.h"
 #include "Kismet/GameplayStatics.h"
+#include "../Misc/AimQuerySubsystem.h"
 #include "../../../../Character/SpeegyptCharacter.h"
 
 // Sets default values for this component's properties
@@ -51,19 +52,19 @@ void UAimedVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		{
 			FVector StartTrace = Player->GetFirstPersonCameraComponent()->GetComponentLocation();
 			FVector ForwardVector = Player->GetFirstPersonCameraComponent()->GetForwardVector();
-			FVector EndTrace = ((ForwardVector * Range) + StartTrace);
-			FCollisionQueryParams TraceParams = FCollisionQueryParams();
-			UWorld* World = GetWorld();
+			UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+			bool bHit = false;
 
-			if (World)
+			// Nothing to act on until the first aim trace has come back
+			if (AimQuery && AimQuery->QueryAim(StartTrace, ForwardVector, Range, CollisionChannel, HitResult, bHit))
 			{
-				if (World->LineTraceSingleByChannel(HitResult, StartTrace, EndTrace, CollisionChannel, TraceParams))
+				if (bHit)
 				{
 					//SCREENMSG(HitResult.Actor->GetName());
 					AActor* Actor = Cast<AActor>(HitResult.Actor);
 					if (Actor)
 					{
-						UActorComponent* Component = Actor->GetComponentByClass(UActiveVesselTarget::StaticClass());
+						UActiveVesselTarget* Component = AimQuery->FindTarget<UActiveVesselTarget>(Actor);
 						if (Component)
 						{
 							if (AbilityState == EVesselAbilityState::Firing)
@@ -85,8 +86,18 @@ void UAimedVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 				}
 				else
 				{
+					// Violet picks the best target in the view cone when the trace misses
 					if (Cast<UVioletVesselEffect>(this))
-						DrawReticle();
+					{
+						if (AbilityState == EVesselAbilityState::Firing)
+						{
+							ApplyEffect();
+							HideReticle();
+							ChargeAmount = 0;
+						}
+						else
+							DrawReticle();
+					}
 					else
 						HideReticle();
 					if (bRMBDown)
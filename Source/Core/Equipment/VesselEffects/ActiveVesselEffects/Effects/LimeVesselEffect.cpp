@@ -2,13 +2,14 @@
 
 
 #include "LimeVesselEffect.h"
+#include "../Misc/AimQuerySubsystem.h"
 
 // Sets default values for this component's properties
 ULimeVesselEffect::ULimeVesselEffect()
 {
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 
 
 	// Mesh Setup
@@ -37,8 +38,11 @@ void ULimeVesselEffect::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if(HitCone)
+	if (HitCone)
+	{
+		HitCone->OnComponentBeginOverlap.AddDynamic(this, &ULimeVesselEffect::OnOverlapBegin);
 		HitCone->OnComponentEndOverlap.AddDynamic(this, &ULimeVesselEffect::OnOverlapEnd);
+	}
 }
 
 // Called every frame
@@ -46,34 +50,29 @@ void ULimeVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	TArray<UPrimitiveComponent*> NewTargets;
-	if(HitCone)
-		HitCone->GetOverlappingComponents(NewTargets);
-	for (auto& Target : NewTargets)
+	// ...
+}
+
+void ULimeVesselEffect::OnOverlapBegin(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	UStaticMeshComponent* NewTarget = Cast<UStaticMeshComponent>(OtherComp);
+	if (NewTarget && NewTarget->GetOwner() && !IsComponentAffected(NewTarget))
 	{
-		if (Target)
+		TArray<UActiveVesselTarget*> VesselTargets;
+		UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+		if (AimQuery)
+			AimQuery->GetTargets(NewTarget->GetOwner(), VesselTargets);
+
+		for (auto& VesselTarget : VesselTargets)
 		{
-			UStaticMeshComponent* NewTarget = Cast<UStaticMeshComponent>(Target);
-			if (NewTarget && !IsComponentAffected(NewTarget))
+			ULimeVesselTarget* PureTarget = Cast<ULimeVesselTarget>(VesselTarget);
+			if (PureTarget)
 			{
-				TArray<UActorComponent*> VesselTargets;
-				NewTarget->GetOwner()->GetComponents(VesselTargets);
-
-				if (VesselTargets.Num() > 0)
-				{
-					for (auto& VesselTarget : VesselTargets)
-					{
-						ULimeVesselTarget* PureTarget = Cast<ULimeVesselTarget>(VesselTarget);
-						if (PureTarget)
-						{
-							if (!Targets.Contains(PureTarget))
-								Targets.Add(PureTarget);
-							if (!AffectedComponents.Contains(NewTarget))
-								AffectedComponents.Add(NewTarget);
-							ApplyEffect(PureTarget, NewTarget);
-						}
-					}
-				}
+				if (!Targets.Contains(PureTarget))
+					Targets.Add(PureTarget);
+				if (!AffectedComponents.Contains(NewTarget))
+					AffectedComponents.Add(NewTarget);
+				ApplyEffect(PureTarget, NewTarget);
 			}
 		}
 	}
@@ -86,8 +85,10 @@ void ULimeVesselEffect::OnOverlapEnd(class UPrimitiveComponent* OverlappedComp,
 		UStaticMeshComponent* PureOtherComp = Cast<UStaticMeshComponent>(OtherComp);
 		if (IsComponentAffected(PureOtherComp))
 		{
-			TArray<UActorComponent*> VesselTargets;
-			OtherActor->GetComponents(VesselTargets);
+			TArray<UActiveVesselTarget*> VesselTargets;
+			UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+			if (AimQuery)
+				AimQuery->GetTargets(OtherActor, VesselTargets);
 
 			if (VesselTargets.Num() > 0)
 			{
@@ -160,16 +161,10 @@ void ULimeVesselEffect::ApplyEffect(UActiveVesselTarget* Target, UStaticMeshComp
 		ULimeVesselTarget* PureTarget = Cast<ULimeVesselTarget>(Target);
 		if (PureTarget)
 		{
-			ULimeTargetData* Component = Cast<ULimeTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
-			if (Component)
-			{
-				if (AbilityState == EVesselAbilityState::Firing)
-					Component->ChargingState = EChargingState::Charging;
-				else if (AbilityState == EVesselAbilityState::Aiming)
-					Component->ChargingState = EChargingState::Depleteing;
-
-				PureTarget->SetDataOfComponent(Component);
-			}
+			if (AbilityState == EVesselAbilityState::Firing)
+				PureTarget->SetChargingState(TargetComponent, EChargingState::Charging);
+			else if (AbilityState == EVesselAbilityState::Aiming)
+				PureTarget->SetChargingState(TargetComponent, EChargingState::Depleteing);
 		}
 	}
 }
@@ -181,12 +176,7 @@ void ULimeVesselEffect::RemoveEffect(UActiveVesselTarget* Target, UStaticMeshCom
 		ULimeVesselTarget* PureTarget = Cast<ULimeVesselTarget>(Target);
 		if (PureTarget)
 		{
-			ULimeTargetData* Component = Cast<ULimeTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
-			if (Component)
-			{
-				Component->ChargingState = EChargingState::Idle;
-				PureTarget->SetDataOfComponent(Component);
-			}
+			PureTarget->SetChargingState(TargetComponent, EChargingState::Idle);
 		}
 	}
 }
\ No newline at end of file
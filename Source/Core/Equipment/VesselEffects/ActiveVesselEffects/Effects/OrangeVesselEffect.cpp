@@ -2,6 +2,7 @@
 
 
 #include "OrangeVesselEffect.h"
+#include "../Misc/AimQuerySubsystem.h"
 
 // Sets default values for this component's properties
 UOrangeVesselEffect::UOrangeVesselEffect()
@@ -19,12 +20,13 @@ UOrangeVesselEffect::UOrangeVesselEffect()
 
 void UOrangeVesselEffect::ApplyEffect()
 {
-	if (Cast<AActor>(HitResult.Actor))
+	UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+	if (Cast<AActor>(HitResult.Actor) && AimQuery)
 	{
-		UOrangeVesselTarget* Target = Cast<UOrangeVesselTarget>(HitResult.Actor->GetComponentByClass(UOrangeVesselTarget::StaticClass()));
+		UOrangeVesselTarget* Target = AimQuery->FindTarget<UOrangeVesselTarget>(HitResult.Actor.Get());
 		if (Target && Target->Owner)
 		{
-			UOrangeTargetData* Data = Cast<UOrangeTargetData>(Target->GetDataOfComponent(Cast<UPrimitiveComponent>(HitResult.Component)));
+			FTargetComponentData* Data = Target->GetDataOfComponent(HitResult.GetComponent());
 			if (PillarManager && Data && Data->bIsAffectedByThisEffect)
 			{
 				FVector Location = FVector(HitResult.Location.X, HitResult.Location.Y, HitResult.Location.Z);
@@ -39,12 +41,13 @@ void UOrangeVesselEffect::ApplyEffect()
 
 void UOrangeVesselEffect::DrawReticle()
 {
-	if (Cast<AActor>(HitResult.Actor))
+	UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+	if (Cast<AActor>(HitResult.Actor) && AimQuery)
 	{
-		UOrangeVesselTarget* Target = Cast<UOrangeVesselTarget>(HitResult.Actor->GetComponentByClass(UOrangeVesselTarget::StaticClass()));
+		UOrangeVesselTarget* Target = AimQuery->FindTarget<UOrangeVesselTarget>(HitResult.Actor.Get());
 		if (Target && Target->Owner)
 		{
-			UOrangeTargetData* Data = Cast<UOrangeTargetData>(Target->GetDataOfComponent(Cast<UPrimitiveComponent>(HitResult.Component)));
+			FTargetComponentData* Data = Target->GetDataOfComponent(HitResult.GetComponent());
 			if (PillarManager && Data && Data->bIsAffectedByThisEffect)
 			{
 				FVector Location = FVector(HitResult.Location.X, HitResult.Location.Y, HitResult.Location.Z);
@@ -3,6 +3,8 @@
 
 #include "VioletVesselEffect.h"
 #include "../../../../Character/SpeegyptCharacter.h"
+#include "../Misc/AimQuerySubsystem.h"
+#include "Camera/CameraComponent.h"
 
 #define FIND_SPOT_CHANNEL ECC_GameTraceChannel9
 
@@ -20,6 +22,8 @@ UVioletVesselEffect::UVioletVesselEffect()
 	CaptureCapsule->SetCapsuleHalfHeight(CaptureCapsule->GetScaledCapsuleRadius());
 	CaptureCapsule->SetCollisionProfileName("VioletEffect");
 	Range = 2000;
+
+	PlacementTraceDelegate.BindUObject(this, &UVioletVesselEffect::OnPlacementSwept);
 }
 
 // Called when the game starts
@@ -31,6 +35,13 @@ void UVioletVesselEffect::BeginPlay()
 	
 }
 
+void UVioletVesselEffect::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ClearPendingSwap();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // Called every frame
 void UVioletVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
@@ -49,161 +60,264 @@ void UVioletVesselEffect::Disable()
 {
 	Super::Disable();
 	CaptureCapsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ClearPendingSwap();
 }
 
 void UVioletVesselEffect::DrawReticle()
 {
-	if (VioletTargetTracker)
+	if (VioletTargetTracker && GetOwner())
 	{
-		for (auto& Target : VioletTargetTracker->VioletTargets)
+		TArray<UVioletVesselTarget*> InRange = VioletTargetTracker->GetTargetsInRange(GetOwner()->GetActorLocation(), Range);
+
+		for (auto& Target : HighlightedTargets)
 		{
-			if (Target->Owner && GetOwner())
-			{
-				if ((Target->Owner->GetActorLocation() - GetOwner()->GetActorLocation()).SizeSquared() < (Range * Range))
-					Target->DrawReticle();
-				else
-					Target->HideReticle();
-			}
+			if (Target && !Target->IsPendingKill() && !InRange.Contains(Target))
+				Target->HideReticle();
 		}
+		for (auto& Target : InRange)
+		{
+			if (!HighlightedTargets.Contains(Target))
+				Target->DrawReticle();
+		}
+		HighlightedTargets = InRange;
 	}
 }
 
 void UVioletVesselEffect::HideReticle()
 {
-	if (VioletTargetTracker)
+	for (auto& Target : HighlightedTargets)
 	{
-		for (auto& Target : VioletTargetTracker->VioletTargets)
+		if (Target && !Target->IsPendingKill() && Target->Owner)
 		{
-			if (Target->Owner)
-			{
-				Target->HideReticle();
-			}
+			Target->HideReticle();
 		}
 	}
+	HighlightedTargets.Empty();
 }
 
 void UVioletVesselEffect::ApplyEffect()
 {
-	AActor* OtherActor = Cast<AActor>(HitResult.Actor);
-	UWorld* World = GetWorld();
-	if (OtherActor && World && Player)
+	if (bSwapPending)
+		return;
+
+	UPrimitiveComponent* TargetComponent = nullptr;
+	if (GetWorld() && Player)
 	{
-		UActorComponent* TargetFinder = OtherActor->GetComponentByClass(UVioletVesselTarget::StaticClass());
-		if (TargetFinder)
+		UVioletVesselTarget* VioletTarget = FindSwapTarget(TargetComponent);
+		if (VioletTarget && VioletTarget->Owner && TargetComponent)
 		{
-			UVioletVesselTarget* VioletTarget = Cast<UVioletVesselTarget>(TargetFinder);
-			if (VioletTarget && VioletTarget->Owner)
-			{
-				TArray<FVector> MyNewLocations;
-				TArray<UPrimitiveComponent*> MyNearComponents;
-				TArray<UStaticMeshComponent*> MyComponentsToMove;
-				CaptureCapsule->GetOverlappingComponents(MyNearComponents);
+			bSwapPending = true;
+			PendingTarget = VioletTarget;
+			PendingComponent = TargetComponent;
+			PendingPlayerLocation = Player->GetActorLocation();
+
+			TArray<UPrimitiveComponent*> MyNearComponents;
+			TArray<UPrimitiveComponent*> MyComponentsToMove;
+			CaptureCapsule->GetOverlappingComponents(MyNearComponents);
 
-				for (auto& MyComponent : MyNearComponents)
+			for (auto& MyComponent : MyNearComponents)
+			{
+				if (MyComponent && Cast<UStaticMeshComponent>(MyComponent) && MyComponent->IsSimulatingPhysics())
 				{
-					if (MyComponent && Cast<UStaticMeshComponent>(MyComponent) && MyComponent->IsSimulatingPhysics())
-					{
-						FHitResult MyFinderHit;
-						UStaticMeshComponent* MyMesh = Cast<UStaticMeshComponent>(MyComponent);
-						FVector MyMin = FVector(0, 0, 0);
-						FVector MyMax = FVector(0, 0, 0);
-						MyMesh->GetLocalBounds(MyMin, MyMax);
-						MyMin *= MyMesh->GetComponentScale();
-						MyMax *= MyMesh->GetComponentScale();
-						float MyCastRadius = (MyMax.X - MyMin.X) / 2;
-
-						FVector MyFromPlayer = (MyMesh->GetComponentLocation() - Player->GetActorLocation());
-						FVector MyDirectionFromPlayer = MyFromPlayer;
-						MyDirectionFromPlayer.Normalize();
-						float MyDistanceFromPlayer = MyFromPlayer.Size();
-
-						FVector MyStart = VioletTarget->PlayerSpawnLocation->GetComponentLocation() + (MyCastRadius / 2 * VioletTarget->Owner->GetActorUpVector());
-						FVector MyEnd = MyStart + (MyDistanceFromPlayer * MyDirectionFromPlayer);
-
-						if (World->SweepSingleByChannel(MyFinderHit,
-							MyStart,
-							MyEnd,
-							MyDirectionFromPlayer.Rotation().Quaternion(),
-							FIND_SPOT_CHANNEL, // VioletMoveTrace
-							FCollisionShape::MakeBox(FVector(MyCastRadius))))
-						{
-							if ((MyFinderHit.Location - MyStart).SizeSquared() < (MyCastRadius * MyCastRadius))
-								continue; // object cant fit
-
-							MyComponentsToMove.Add(MyMesh);
-							MyNewLocations.Add(MyFinderHit.Location);
-						}
-						else
-						{
-							MyComponentsToMove.Add(MyMesh);
-							MyNewLocations.Add(MyEnd);
-						}
-					}
-				}
+					UStaticMeshComponent* MyMesh = Cast<UStaticMeshComponent>(MyComponent);
+					FVector MyMin = FVector(0, 0, 0);
+					FVector MyMax = FVector(0, 0, 0);
+					MyMesh->GetLocalBounds(MyMin, MyMax);
+					MyMin *= MyMesh->GetComponentScale();
+					MyMax *= MyMesh->GetComponentScale();
+					float MyCastRadius = (MyMax.X - MyMin.X) / 2;
 
-				//*********************************************************************************************************************************
+					FVector MyFromPlayer = (MyMesh->GetComponentLocation() - PendingPlayerLocation);
+					FVector MyDirectionFromPlayer = MyFromPlayer;
+					MyDirectionFromPlayer.Normalize();
+					float MyDistanceFromPlayer = MyFromPlayer.Size();
 
-				TArray<FVector> OtherNewLocations;
-				TArray<UPrimitiveComponent*> OtherNearComponents;
-				TArray<UStaticMeshComponent*> OtherComponentsToMove;
-				VioletTarget->CaptureCapsule->GetOverlappingComponents(OtherNearComponents);
+					FVector MyStart = VioletTarget->PlayerSpawnLocation->GetComponentLocation() + (MyCastRadius / 2 * VioletTarget->Owner->GetActorUpVector());
+					FVector MyEnd = MyStart + (MyDistanceFromPlayer * MyDirectionFromPlayer);
 
-				for (auto& OtherComponent : OtherNearComponents)
-				{
-					if (OtherComponent && Cast<UStaticMeshComponent>(OtherComponent) && OtherComponent->IsSimulatingPhysics() && !MyComponentsToMove.Contains(OtherComponent))
-					{
-						FHitResult OtherFinderHit;
-						UStaticMeshComponent* OtherMesh = Cast<UStaticMeshComponent>(OtherComponent);
-						FVector OtherMin = FVector(0, 0, 0);
-						FVector OtherMax = FVector(0, 0, 0);
-						OtherMesh->GetLocalBounds(OtherMin, OtherMax);
-						OtherMin *= OtherMesh->GetComponentScale();
-						OtherMax *= OtherMesh->GetComponentScale();
-						float OtherCastRadius = (OtherMax.X - OtherMin.X) / 2;
-
-						FVector OtherFromComponent = (OtherMesh->GetComponentLocation() - HitResult.Component->GetComponentLocation());
-						FVector OtherDirectionFromComponent = OtherFromComponent;
-						OtherDirectionFromComponent.Normalize();
-						float OtherDistanceFromComponent = OtherFromComponent.Size();
-
-						FVector OtherStart = Player->GetActorLocation();// +(OtherCastRadius * Player->GetActorUpVector());
-						FVector OtherEnd = OtherStart + (OtherDirectionFromComponent * OtherDistanceFromComponent);
-
-						if (World->SweepSingleByChannel(OtherFinderHit,
-							OtherStart,
-							OtherEnd,
-							OtherDirectionFromComponent.Rotation().Quaternion(),
-							FIND_SPOT_CHANNEL, // VioletMoveTrace
-							FCollisionShape::MakeBox(FVector(OtherCastRadius))))
-						{
-							if ((OtherFinderHit.Location - OtherStart).SizeSquared() < (OtherCastRadius * OtherCastRadius))
-								continue; // object cant fit
-
-							OtherComponentsToMove.Add(OtherMesh);
-							OtherNewLocations.Add(OtherFinderHit.Location);
-						}
-						else
-						{
-							OtherComponentsToMove.Add(OtherMesh);
-							OtherNewLocations.Add(OtherEnd);
-						}
-					}
+					MyComponentsToMove.Add(MyMesh);
+					QueuePlacement(MyMesh, MyStart, MyEnd, MyCastRadius);
 				}
+			}
 
-				//*********************************************************************************************************************************
+			//*********************************************************************************************************************************
 
-				for (int i = 0; i < MyNewLocations.Num(); i++)
-				{
-					MyComponentsToMove[i]->SetWorldLocation(MyNewLocations[i], false, nullptr, ETeleportType::TeleportPhysics);
-				}
-				for (int i = 0; i < OtherNewLocations.Num(); i++)
+			TArray<UPrimitiveComponent*> OtherNearComponents;
+			VioletTarget->CaptureCapsule->GetOverlappingComponents(OtherNearComponents);
+
+			for (auto& OtherComponent : OtherNearComponents)
+			{
+				if (OtherComponent && Cast<UStaticMeshComponent>(OtherComponent) && OtherComponent->IsSimulatingPhysics() && !MyComponentsToMove.Contains(OtherComponent))
 				{
-					OtherComponentsToMove[i]->SetWorldLocation(OtherNewLocations[i], false, nullptr, ETeleportType::TeleportPhysics);
+					UStaticMeshComponent* OtherMesh = Cast<UStaticMeshComponent>(OtherComponent);
+					FVector OtherMin = FVector(0, 0, 0);
+					FVector OtherMax = FVector(0, 0, 0);
+					OtherMesh->GetLocalBounds(OtherMin, OtherMax);
+					OtherMin *= OtherMesh->GetComponentScale();
+					OtherMax *= OtherMesh->GetComponentScale();
+					float OtherCastRadius = (OtherMax.X - OtherMin.X) / 2;
+
+					FVector OtherFromComponent = (OtherMesh->GetComponentLocation() - PendingComponent->GetComponentLocation());
+					FVector OtherDirectionFromComponent = OtherFromComponent;
+					OtherDirectionFromComponent.Normalize();
+					float OtherDistanceFromComponent = OtherFromComponent.Size();
+
+					FVector OtherStart = PendingPlayerLocation;// +(OtherCastRadius * Player->GetActorUpVector());
+					FVector OtherEnd = OtherStart + (OtherDirectionFromComponent * OtherDistanceFromComponent);
+
+					QueuePlacement(OtherMesh, OtherStart, OtherEnd, OtherCastRadius);
 				}
-				FVector Temp = Player->GetActorLocation();
-				Player->SetActorLocation(VioletTarget->PlayerSpawnLocation->GetComponentLocation(), false, nullptr, ETeleportType::TeleportPhysics);
-				HitResult.Component->SetWorldLocation(Temp, false, nullptr, ETeleportType::TeleportPhysics);
 			}
+
+			// Nothing to move out of the way, the swap can happen straight away
+			if (NumPendingSweeps == 0)
+				CommitSwap();
 		}
 	}
-}
\ No newline at end of file
+}
+
+UVioletVesselTarget* UVioletVesselEffect::FindSwapTarget(UPrimitiveComponent*& OutComponent) const
+{
+	OutComponent = nullptr;
+
+	AActor* OtherActor = Cast<AActor>(HitResult.Actor);
+	UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+	if (OtherActor && AimQuery && HitResult.Component.IsValid())
+	{
+		UVioletVesselTarget* VioletTarget = AimQuery->FindTarget<UVioletVesselTarget>(OtherActor);
+		if (VioletTarget)
+		{
+			OutComponent = HitResult.Component.Get();
+			return VioletTarget;
+		}
+	}
+
+	// The trace missed, fall back to the target closest to the middle of the view
+	if (!VioletTargetTracker || !Player || !Player->GetFirstPersonCameraComponent())
+		return nullptr;
+
+	UCameraComponent* Camera = Player->GetFirstPersonCameraComponent();
+	UVioletVesselTarget* VioletTarget = VioletTargetTracker->FindBestTarget(Camera->GetComponentLocation(), Camera->GetForwardVector(), Range, AimAssistAngle);
+	if (VioletTarget)
+	{
+		for (auto& Data : VioletTarget->VioletData)
+		{
+			if (Data.Component && Data.bIsAffectedByThisEffect)
+			{
+				OutComponent = Data.Component;
+				return VioletTarget;
+			}
+		}
+	}
+	return nullptr;
+}
+
+bool UVioletVesselEffect::IsReserved(UPrimitiveComponent* Component) const
+{
+	if (!bSwapPending || !Component)
+		return false;
+
+	if (Component == PendingComponent)
+		return true;
+
+	for (auto& Placement : PendingPlacements)
+	{
+		if (Placement.Mesh == Component)
+			return true;
+	}
+	return false;
+}
+
+bool UVioletVesselEffect::IsActorReserved(AActor* Actor) const
+{
+	if (!bSwapPending || !Actor)
+		return false;
+
+	if (PendingTarget && PendingTarget->Owner == Actor)
+		return true;
+	if (PendingComponent && PendingComponent->GetOwner() == Actor)
+		return true;
+
+	for (auto& Placement : PendingPlacements)
+	{
+		if (Placement.Mesh && Placement.Mesh->GetOwner() == Actor)
+			return true;
+	}
+	return false;
+}
+
+void UVioletVesselEffect::QueuePlacement(UStaticMeshComponent* Mesh, FVector Start, FVector End, float CastRadius)
+{
+	FVioletPlacement& Placement = PendingPlacements.AddDefaulted_GetRef();
+	Placement.Mesh = Mesh;
+	Placement.Start = Start;
+	Placement.End = End;
+	Placement.CastRadius = CastRadius;
+
+	FVector Direction = (End - Start).GetSafeNormal();
+	Placement.Handle = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single,
+		Start,
+		End,
+		Direction.Rotation().Quaternion(),
+		FIND_SPOT_CHANNEL, // VioletMoveTrace
+		FCollisionShape::MakeBox(FVector(CastRadius)),
+		FCollisionQueryParams::DefaultQueryParam,
+		FCollisionResponseParams::DefaultResponseParam,
+		&PlacementTraceDelegate);
+	NumPendingSweeps++;
+}
+
+void UVioletVesselEffect::OnPlacementSwept(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (!bSwapPending)
+		return;
+
+	for (auto& Placement : PendingPlacements)
+	{
+		if (!Placement.bResolved && Placement.Handle == Handle)
+		{
+			Placement.bResolved = true;
+			if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
+			{
+				// object cant fit
+				Placement.bFits = (Datum.OutHits[0].Location - Placement.Start).SizeSquared() >= (Placement.CastRadius * Placement.CastRadius);
+				Placement.Location = Datum.OutHits[0].Location;
+			}
+			else
+			{
+				Placement.bFits = true;
+				Placement.Location = Placement.End;
+			}
+
+			if (--NumPendingSweeps == 0)
+				CommitSwap();
+			return;
+		}
+	}
+}
+
+void UVioletVesselEffect::CommitSwap()
+{
+	for (auto& Placement : PendingPlacements)
+	{
+		if (Placement.bFits && Placement.Mesh && !Placement.Mesh->IsPendingKill())
+			Placement.Mesh->SetWorldLocation(Placement.Location, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	if (Player && PendingTarget && !PendingTarget->IsPendingKill() && PendingTarget->PlayerSpawnLocation && PendingComponent && !PendingComponent->IsPendingKill())
+	{
+		Player->SetActorLocation(PendingTarget->PlayerSpawnLocation->GetComponentLocation(), false, nullptr, ETeleportType::TeleportPhysics);
+		PendingComponent->SetWorldLocation(PendingPlayerLocation, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	ClearPendingSwap();
+}
+
+void UVioletVesselEffect::ClearPendingSwap()
+{
+	bSwapPending = false;
+	PendingPlacements.Empty();
+	PendingTarget = nullptr;
+	PendingComponent = nullptr;
+	NumPendingSweeps = 0;
+}
@@ -8,8 +8,34 @@
 #include "../Targets/VioletVesselTarget.h"
 #include "../Misc/VioletTargetTracker.h"
 #include "Components/CapsuleComponent.h"
+#include "WorldCollision.h"
 #include "VioletVesselEffect.generated.h"
 
+/// Placement of one physics object moved aside by a swap, filled in when its async sweep comes back.
+USTRUCT()
+struct FVioletPlacement
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UStaticMeshComponent* Mesh = nullptr;
+
+	FVector Start = FVector::ZeroVector;
+
+	FVector End = FVector::ZeroVector;
+
+	float CastRadius = 0;
+
+	FTraceHandle Handle;
+
+	bool bResolved = false;
+
+	/// False if the sweep hit something before the object could fit, the object is left where it is.
+	bool bFits = false;
+
+	FVector Location = FVector::ZeroVector;
+};
+
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SPEEGYPT_API UVioletVesselEffect : public UAimedVesselEffect
@@ -26,6 +52,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UVioletTargetTracker* VioletTargetTracker;
 
+	/// Targets currently showing their reticle, so only targets entering or leaving range are touched each frame.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<UVioletVesselTarget*> HighlightedTargets;
+
 	void Enable() override;
 
 	void Disable() override;
@@ -36,10 +66,60 @@ public:
 
 	void ApplyEffect() override;
 
+	/// Half angle of the view cone searched for a target when the aim trace doesn't land on one.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AimAssistAngle = 10.f;
+
+	/// True while a swap is waiting on its placement sweeps. Further swaps are ignored until it commits.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bSwapPending = false;
+
+	/// Returns true if the component is being moved by the pending swap.
+	UFUNCTION(BlueprintCallable)
+	bool IsReserved(UPrimitiveComponent* Component) const;
+
+	/// Returns true if the actor is the pending swap target or owns a component the swap is moving. Grabbing such an actor is refused.
+	UFUNCTION(BlueprintCallable)
+	bool IsActorReserved(AActor* Actor) const;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Drops a pending swap, its sweep results are ignored when they come back.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// Objects moved by the pending swap, in the order they are committed.
+	UPROPERTY()
+	TArray<FVioletPlacement> PendingPlacements;
+
+	/// Target and hit component reserved by the pending swap.
+	UPROPERTY()
+	UVioletVesselTarget* PendingTarget = nullptr;
+
+	UPROPERTY()
+	UPrimitiveComponent* PendingComponent = nullptr;
+
+	/// Where the player stood when the swap was applied, the hit component is moved here on commit.
+	FVector PendingPlayerLocation = FVector::ZeroVector;
+
+	int NumPendingSweeps = 0;
+
+	FTraceDelegate PlacementTraceDelegate;
+
+	/// Adds a placement for the mesh and issues its sweep from Start to End.
+	void QueuePlacement(UStaticMeshComponent* Mesh, FVector Start, FVector End, float CastRadius);
+
+	void OnPlacementSwept(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/// Moves every object that fit, then swaps the player with the hit component, all in one frame.
+	void CommitSwap();
+
+	void ClearPendingSwap();
+
+	/// Target hit by the aim trace, or the best target in the view cone if it missed. OutComponent is the component swapped with the player.
+	UVioletVesselTarget* FindSwapTarget(UPrimitiveComponent*& OutComponent) const;
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
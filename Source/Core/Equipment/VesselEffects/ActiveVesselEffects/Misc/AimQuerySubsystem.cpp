@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AimQuerySubsystem.h"
+#include "Engine/World.h"
+#include "../Targets/ActiveVesselTarget.h"
+
+UAimQuerySubsystem* UAimQuerySubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UAimQuerySubsystem>() : nullptr;
+}
+
+void UAimQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	AimTraceDelegate.BindUObject(this, &UAimQuerySubsystem::OnAimTraced);
+}
+
+void UAimQuerySubsystem::Deinitialize()
+{
+	Queries.Empty();
+	TargetCache.Empty();
+	AimTraceDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+bool UAimQuerySubsystem::QueryAim(const FVector& Start, const FVector& Direction, float Range, ECollisionChannel Channel, FHitResult& OutHit, bool& bOutHit)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return false;
+
+	FAimQuery& Query = Queries.FindOrAdd(Channel);
+
+	bool bHasMoved = !Query.bHasResult && !Query.bIsPending;
+	bHasMoved |= (Start - Query.Start).SizeSquared() > MoveThreshold * MoveThreshold;
+	bHasMoved |= FVector::DotProduct(Direction, Query.Direction) < FMath::Cos(FMath::DegreesToRadians(AngleThreshold));
+	bHasMoved |= Range != Query.Range;
+	bool bIsStale = World->GetTimeSeconds() - Query.IssueTime > MaxResultAge;
+
+	if (!Query.bIsPending && (bHasMoved || bIsStale) && LastIssueFrame != GFrameCounter)
+	{
+		Query.Start = Start;
+		Query.Direction = Direction;
+		Query.Range = Range;
+		Query.IssueTime = World->GetTimeSeconds();
+		Query.bIsPending = true;
+		Query.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, Start + (Direction * Range), Channel,
+			FCollisionQueryParams::DefaultQueryParam, FCollisionResponseParams::DefaultResponseParam, &AimTraceDelegate);
+		LastIssueFrame = GFrameCounter;
+	}
+
+	if (!Query.bHasResult || World->GetTimeSeconds() - Query.ResultTime > MaxResultAge)
+		return false;
+
+	OutHit = Query.HitResult;
+	bOutHit = Query.bHit;
+	return true;
+}
+
+void UAimQuerySubsystem::OnAimTraced(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	for (auto& Query : Queries)
+	{
+		if (Query.Value.bIsPending && Query.Value.Handle == Handle)
+		{
+			Query.Value.bIsPending = false;
+			Query.Value.bHasResult = true;
+			Query.Value.ResultTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0;
+			Query.Value.bHit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+			Query.Value.HitResult = Query.Value.bHit ? Datum.OutHits[0] : FHitResult();
+			return;
+		}
+	}
+}
+
+void UAimQuerySubsystem::GetTargets(AActor* Actor, TArray<UActiveVesselTarget*>& OutTargets)
+{
+	for (auto& Target : GetCachedTargets(Actor))
+	{
+		if (Target.IsValid())
+			OutTargets.Add(Target.Get());
+	}
+}
+
+void UAimQuerySubsystem::InvalidateTargets(AActor* Actor)
+{
+	if (Actor)
+		TargetCache.Remove(Actor);
+}
+
+const TArray<TWeakObjectPtr<UActiveVesselTarget>>& UAimQuerySubsystem::GetCachedTargets(AActor* Actor)
+{
+	static const TArray<TWeakObjectPtr<UActiveVesselTarget>> NoTargets;
+	if (!Actor)
+		return NoTargets;
+
+	TArray<TWeakObjectPtr<UActiveVesselTarget>>* Targets = TargetCache.Find(Actor);
+	if (Targets)
+	{
+		bool bIsValid = true;
+		for (auto& Target : *Targets)
+			bIsValid &= Target.IsValid();
+		if (bIsValid)
+			return *Targets;
+	}
+
+	if (TargetCache.Num() > 256)
+		PurgeTargetCache();
+
+	TArray<UActiveVesselTarget*> Found;
+	Actor->GetComponents<UActiveVesselTarget>(Found);
+
+	TArray<TWeakObjectPtr<UActiveVesselTarget>>& NewTargets = TargetCache.FindOrAdd(Actor);
+	NewTargets.Reset();
+	for (auto& Target : Found)
+		NewTargets.Add(Target);
+	return NewTargets;
+}
+
+void UAimQuerySubsystem::PurgeTargetCache()
+{
+	for (auto It = TargetCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+}
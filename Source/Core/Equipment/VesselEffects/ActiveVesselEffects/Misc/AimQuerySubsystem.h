@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "AimQuerySubsystem.generated.h"
+
+class UActiveVesselTarget;
+
+/// Last aim trace issued on a channel and the result it came back with.
+struct FAimQuery
+{
+	FVector Start = FVector::ZeroVector;
+
+	FVector Direction = FVector::ZeroVector;
+
+	float Range = 0;
+
+	float IssueTime = 0;
+
+	/// Time the latest result came back.
+	float ResultTime = 0;
+
+	FTraceHandle Handle;
+
+	bool bIsPending = false;
+
+	bool bHasResult = false;
+
+	bool bHit = false;
+
+	FHitResult HitResult;
+};
+
+/// Aim traces shared by the aimed vessel effects. Traces are issued asynchronously, at most one per frame, and only when the
+/// camera has moved or the last result has gone stale. Also caches the vessel targets of every actor that was looked up.
+UCLASS()
+class SPEEGYPT_API UAimQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// Returns the subsystem of the given world, or nullptr if there isn't one.
+	static UAimQuerySubsystem* Get(const UWorld* World);
+
+	/// Returns false while the first trace on the channel is in flight, or while the latest result is older than MaxResultAge.
+	/// Otherwise fills OutHit with the latest result and bOutHit with whether it was a blocking hit, issuing a new trace if the
+	/// aim has moved since the last one.
+	bool QueryAim(const FVector& Start, const FVector& Direction, float Range, ECollisionChannel Channel, FHitResult& OutHit, bool& bOutHit);
+
+	/// Fills OutTargets with the vessel targets on the given actor, looked up once and cached.
+	void GetTargets(AActor* Actor, TArray<UActiveVesselTarget*>& OutTargets);
+
+	/// Forgets the cached targets of the actor, so they are looked up again next time. Called when a target is registered or unregistered.
+	void InvalidateTargets(AActor* Actor);
+
+	/// Returns the first vessel target of the given class on the actor.
+	template<class T>
+	T* FindTarget(AActor* Actor)
+	{
+		for (auto& Target : GetCachedTargets(Actor))
+		{
+			T* PureTarget = Cast<T>(Target.Get());
+			if (PureTarget)
+				return PureTarget;
+		}
+		return nullptr;
+	}
+
+	/// Distance the camera has to move before a new trace is issued.
+	float MoveThreshold = 1.f;
+
+	/// Angle in degrees the camera has to turn before a new trace is issued.
+	float AngleThreshold = 0.5f;
+
+	/// Results older than this are traced again even if the camera hasn't moved, so moving targets are still picked up.
+	/// They are also never returned, so a result left over from the last time the channel was aimed can't be acted on.
+	float MaxResultAge = 0.1f;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	TMap<TEnumAsByte<ECollisionChannel>, FAimQuery> Queries;
+
+	/// Vessel targets by actor, filled in the first time an actor is looked up.
+	TMap<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UActiveVesselTarget>>> TargetCache;
+
+	const TArray<TWeakObjectPtr<UActiveVesselTarget>>& GetCachedTargets(AActor* Actor);
+
+	/// Frame the last trace was issued on.
+	uint64 LastIssueFrame = 0;
+
+	FTraceDelegate AimTraceDelegate;
+
+	void OnAimTraced(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/// Removes cached actors and targets that have been destroyed.
+	void PurgeTargetCache();
+};
@@ -2,15 +2,25 @@
 
 
 #include "RockPillar.h"
+#include "RockPillarManager.h"
 #include "UObject/ConstructorHelpers.h"
 
+void URockPillarMesh::OnVisibilityChanged()
+{
+	Super::OnVisibilityChanged();
+
+	ARockPillar* Pillar = Cast<ARockPillar>(GetOwner());
+	if (Pillar)
+		Pillar->OnMeshVisibilityChanged();
+}
+
 // Sets default values
 ARockPillar::ARockPillar()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// Pooled pillars sit in the world hidden, the manager drives them so they never need to tick
+	PrimaryActorTick.bCanEverTick = false;
 
-	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Pillar Mesh"));
+	Mesh = CreateDefaultSubobject<URockPillarMesh>(TEXT("Pillar Mesh"));
 
 	static ConstructorHelpers::FObjectFinder<UStaticMesh> MeshFinder(TEXT("StaticMesh'/Game/Speegypt/Environment/Meshes/Pillar.Pillar'"));
 	if (MeshFinder.Object)
@@ -34,12 +44,44 @@ void ARockPillar::BeginPlay()
 		Mesh->OnComponentBeginOverlap.AddDynamic(this, &ARockPillar::OnOverlapBegin);
 }
 
+void ARockPillar::Activate(FVector Location, FRotator Rotation, float Force)
+{
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	SpawnTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0;
+	SpawnForce = Force;
+	bDespawnFlag = false;
+	DespawnFrameDelay = 3;
+
+	if (Mesh)
+		Mesh->SetVisibility(true);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+}
+
+void ARockPillar::Deactivate()
+{
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	bDespawnFlag = false;
+}
+
+void ARockPillar::OnMeshVisibilityChanged()
+{
+	if (Manager)
+		Manager->OnPillarVisibilityChanged(this);
+}
+
 void ARockPillar::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
 	ARockPillar* PurePillar = Cast<ARockPillar>(OtherComp);
 	if (PurePillar)
 	{
 		if (this > PurePillar)
-			Destroy();
+		{
+			bDespawnFlag = true;
+			if (Manager)
+				Manager->QueueDespawn(this);
+		}
 	}
 }
@@ -5,8 +5,21 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
 #include "RockPillar.generated.h"
 
+class URockPillarManager;
+
+/// Mesh used by ARockPillar. Tells the pillar when its visibility changes, so the manager only has to watch pillars that have been hidden.
+UCLASS()
+class SPEEGYPT_API URockPillarMesh : public UStaticMeshComponent
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void OnVisibilityChanged() override;
+};
+
 UCLASS()
 class SPEEGYPT_API ARockPillar : public AActor
 {
@@ -17,10 +30,19 @@ public:
 	ARockPillar();
 
 	UPROPERTY()
-	UStaticMeshComponent* Mesh;
+	URockPillarMesh* Mesh;
 
+	/// Manager that owns this pillar, told about visibility changes and despawn requests.
+	UPROPERTY()
+	URockPillarManager* Manager;
+
+	/// World time the pillar was last activated at.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SpawnTime = 0;
+
+	/// World time the pillar expires at, set by the manager when it is activated.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	float CurrentLifetime = 0;
+	float ExpireTime = 0;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	float SpawnForce = 0;
@@ -31,6 +53,14 @@ public:
 	UPROPERTY()
 	int DespawnFrameDelay = 3;
 
+	/// Moves a pooled pillar into place and makes it visible and collidable again.
+	UFUNCTION(BlueprintCallable)
+	void Activate(FVector Location, FRotator Rotation, float Force);
+
+	/// Hides the pillar, turns its collision off and detaches it so it can be parked in the pool.
+	UFUNCTION(BlueprintCallable)
+	void Deactivate();
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -41,9 +71,13 @@ public:
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
 	FORCEINLINE bool operator==(const ARockPillar& Other) const { return GetName() == Other.GetName(); }
-	FORCEINLINE bool operator>=(const ARockPillar& Other) const { return CurrentLifetime >= Other.CurrentLifetime; }
-	FORCEINLINE bool operator<=(const ARockPillar& Other) const { return CurrentLifetime <= Other.CurrentLifetime; }
-	FORCEINLINE bool operator>(const ARockPillar& Other) const { return CurrentLifetime > Other.CurrentLifetime; }
-	FORCEINLINE bool operator<(const ARockPillar& Other) const { return CurrentLifetime < Other.CurrentLifetime; }
+	/// Called by Mesh whenever its visibility changes.
+	void OnMeshVisibilityChanged();
+
+	// Pillars compare by age, an older pillar was spawned earlier.
+	FORCEINLINE bool operator>=(const ARockPillar& Other) const { return SpawnTime <= Other.SpawnTime; }
+	FORCEINLINE bool operator<=(const ARockPillar& Other) const { return SpawnTime >= Other.SpawnTime; }
+	FORCEINLINE bool operator>(const ARockPillar& Other) const { return SpawnTime < Other.SpawnTime; }
+	FORCEINLINE bool operator<(const ARockPillar& Other) const { return SpawnTime > Other.SpawnTime; }
 
 };
@@ -2,6 +2,7 @@
 
 
 #include "RockPillarManager.h"
+#include "TimerManager.h"
 
 // Sets default values for this component's properties
 URockPillarManager::URockPillarManager()
@@ -9,6 +10,7 @@ URockPillarManager::URockPillarManager()
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
 	Reticle = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Reticle"));
 	
@@ -33,17 +35,39 @@ bool URockPillarManager::SpawnPillar(FVector Location, FRotator Rotation, float
 {
 	if (GetWorld())
 	{
-		int ExcessPillars = Pillars.Num() - MaxPillars;
-		while (ExcessPillars >= 0)
+		if (Pillars.Num() != FMath::Max(MaxPillars, 1))
+			ResizeRing();
+		while (NumActivePillars >= Pillars.Num())
 		{
-			DestroyPillar(Pillars[0]);
-			ExcessPillars = Pillars.Num() - MaxPillars;
+			ARockPillar* Oldest = GetActivePillar(0);
+			if (Oldest)
+				DestroyPillar(Oldest);
+			else
+				RemoveActivePillar(nullptr);
+		}
+
+		ARockPillar* Temp = nullptr;
+		while (!Temp && PillarPool.Num() > 0)
+		{
+			Temp = PillarPool.Pop();
+			if (Temp && Temp->IsPendingKill())
+				Temp = nullptr;
 		}
-		ARockPillar* Temp = (ARockPillar*)GetWorld()->SpawnActor(ARockPillar::StaticClass(), &Location, &Rotation);
+		if (!Temp)
+			Temp = SpawnPooledPillar();
+
 		if (Temp)
 		{
-			Temp->SpawnForce = Force;
-			Pillars.Add(Temp);
+			Temp->Manager = this;
+			Temp->Activate(Location, Rotation, Force);
+			Temp->ExpireTime = Temp->SpawnTime + MaxPillarLifetime;
+
+			// Every pillar lives for MaxPillarLifetime, so the newest pillar always expires last.
+			Pillars[(PillarHead + NumActivePillars) % Pillars.Num()] = Temp;
+			NumActivePillars++;
+			if (NumActivePillars == 1)
+				ScheduleExpiry();
+
 			if (Component)
 			{
 				EAttachmentRule Rule = EAttachmentRule::KeepWorld;
@@ -61,9 +85,154 @@ void URockPillarManager::DestroyPillar(ARockPillar* Pillar)
 {
 	if (Pillar)
 	{
-		if(Pillars.Remove(Pillar))
-			Pillar->Destroy();
+		PendingDespawns.Remove(Pillar);
+
+		bool bWasOldest = GetActivePillar(0) == Pillar;
+		if (RemoveActivePillar(Pillar))
+		{
+			if (!Pillar->IsPendingKill())
+			{
+				Pillar->Deactivate();
+				PillarPool.Add(Pillar);
+			}
+			if (bWasOldest)
+				ScheduleExpiry();
+		}
+	}
+}
+
+ARockPillar* URockPillarManager::GetActivePillar(int Index) const
+{
+	if (Index < 0 || Index >= NumActivePillars || Pillars.Num() == 0)
+		return nullptr;
+
+	return Pillars[(PillarHead + Index) % Pillars.Num()];
+}
+
+bool URockPillarManager::RemoveActivePillar(ARockPillar* Pillar)
+{
+	for (int i = 0; i < NumActivePillars; i++)
+	{
+		if (GetActivePillar(i) == Pillar)
+		{
+			// Close the gap by shifting the younger pillars back a slot, the ring stays ordered by expiry.
+			for (int j = i; j < NumActivePillars - 1; j++)
+				Pillars[(PillarHead + j) % Pillars.Num()] = GetActivePillar(j + 1);
+			Pillars[(PillarHead + NumActivePillars - 1) % Pillars.Num()] = nullptr;
+			NumActivePillars--;
+
+			if (NumActivePillars == 0)
+				PillarHead = 0;
+			return true;
+		}
+	}
+	return false;
+}
+
+void URockPillarManager::ResizeRing()
+{
+	int Capacity = FMath::Max(MaxPillars, 1);
+	while (NumActivePillars > Capacity)
+	{
+		ARockPillar* Oldest = GetActivePillar(0);
+		if (Oldest)
+			DestroyPillar(Oldest);
+		else
+			RemoveActivePillar(nullptr);
+	}
+
+	TArray<ARockPillar*> Active;
+	for (int i = 0; i < NumActivePillars; i++)
+		Active.Add(GetActivePillar(i));
+
+	Pillars.Init(nullptr, Capacity);
+	for (int i = 0; i < Active.Num(); i++)
+		Pillars[i] = Active[i];
+	PillarHead = 0;
+}
+
+void URockPillarManager::ScheduleExpiry()
+{
+	if (!GetWorld())
+		return;
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	TimerManager.ClearTimer(ExpiryTimer);
+
+	ARockPillar* Oldest = GetActivePillar(0);
+	if (Oldest && MaxPillarLifetime > 0)
+	{
+		float Delay = FMath::Max(Oldest->ExpireTime - GetWorld()->GetTimeSeconds(), KINDA_SMALL_NUMBER);
+		TimerManager.SetTimer(ExpiryTimer, this, &URockPillarManager::OnPillarExpired, Delay, false);
+	}
+}
+
+void URockPillarManager::OnPillarExpired()
+{
+	float Now = GetWorld()->GetTimeSeconds();
+	while (NumActivePillars > 0)
+	{
+		ARockPillar* Oldest = GetActivePillar(0);
+		if (!Oldest || Oldest->IsPendingKill())
+			RemoveActivePillar(Oldest);
+		else if (Oldest->ExpireTime <= Now + KINDA_SMALL_NUMBER)
+			DestroyPillar(Oldest);
+		else
+			break;
 	}
+
+	ScheduleExpiry();
+}
+
+void URockPillarManager::OnPillarVisibilityChanged(ARockPillar* Pillar)
+{
+	if (!Pillar || !Pillar->Mesh || MaxPillarLifetime <= 0)
+		return;
+
+	if (!Pillar->Mesh->GetVisibleFlag())
+	{
+		bool bIsActive = false;
+		for (int i = 0; i < NumActivePillars; i++)
+			bIsActive |= GetActivePillar(i) == Pillar;
+
+		if (bIsActive && !PendingDespawns.Contains(Pillar))
+		{
+			Pillar->DespawnFrameDelay = 3;
+			PendingDespawns.Add(Pillar);
+			SetComponentTickEnabled(true);
+		}
+	}
+	else if (!Pillar->bDespawnFlag)
+		PendingDespawns.Remove(Pillar);
+}
+
+void URockPillarManager::QueueDespawn(ARockPillar* Pillar)
+{
+	if (Pillar)
+	{
+		PendingDespawns.Add(Pillar);
+		SetComponentTickEnabled(true);
+	}
+}
+
+ARockPillar* URockPillarManager::SpawnPooledPillar()
+{
+	if (GetWorld())
+	{
+		FVector Location = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		ARockPillar* Pillar = GetWorld()->SpawnActor<ARockPillar>(ARockPillar::StaticClass(), Location, Rotation, SpawnParams);
+		if (Pillar)
+		{
+			Pillar->Manager = this;
+			Pillar->Deactivate();
+		}
+		return Pillar;
+	}
+	return nullptr;
 }
 
 void URockPillarManager::DrawReticle(FVector Location, FRotator Rotation)
@@ -98,33 +267,56 @@ void URockPillarManager::BeginPlay()
 			Reticle->SetMaterial(0, ReticleMat);
 		}
 	}
-}
 
+	ResizeRing();
 
-// Called every frame
-void URockPillarManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+	int NumToSpawn = PoolSize > 0 ? PoolSize : MaxPillars;
+	for (int i = PillarPool.Num(); i < NumToSpawn; i++)
+	{
+		ARockPillar* Pillar = SpawnPooledPillar();
+		if (Pillar)
+			PillarPool.Add(Pillar);
+	}
+}
+
+void URockPillarManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (GetWorld())
+		GetWorld()->GetTimerManager().ClearTimer(ExpiryTimer);
 
-	for (int i = 0; i < Pillars.Num(); i++)
+	for (auto& Pillar : PillarPool)
 	{
-		ARockPillar* Pillar = Pillars[i];
 		if (Pillar && !Pillar->IsPendingKill())
-		{
-			Pillar->CurrentLifetime += DeltaTime;
+			Pillar->Destroy();
+	}
+	PillarPool.Empty();
 
-			if (!Pillar->Mesh->GetVisibleFlag() && Pillar->DespawnFrameDelay)
-				Pillar->DespawnFrameDelay--;
-			else
-				Pillar->DespawnFrameDelay = 3;
+	Super::EndPlay(EndPlayReason);
+}
 
-			if (MaxPillarLifetime && (Pillar->CurrentLifetime > MaxPillarLifetime || !Pillar->DespawnFrameDelay))
-				DestroyPillar(Pillar);
-		}
-		else
+
+// Only ticks while there are pillars waiting on a deferred despawn
+void URockPillarManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	TArray<TWeakObjectPtr<ARockPillar>> Pending = PendingDespawns.Array();
+	for (auto& WeakPillar : Pending)
+	{
+		ARockPillar* Pillar = WeakPillar.Get();
+		if (!Pillar)
+			PendingDespawns.Remove(WeakPillar);
+		else if (Pillar->IsPendingKill() || Pillar->bDespawnFlag)
+			DestroyPillar(Pillar);
+		else if (Pillar->Mesh->GetVisibleFlag())
 		{
-			Pillars.RemoveAt(i);
+			Pillar->DespawnFrameDelay = 3;
+			PendingDespawns.Remove(WeakPillar);
 		}
+		else if (--Pillar->DespawnFrameDelay <= 0)
+			DestroyPillar(Pillar);
 	}
-}
 
+	if (PendingDespawns.Num() == 0)
+		SetComponentTickEnabled(false);
+}
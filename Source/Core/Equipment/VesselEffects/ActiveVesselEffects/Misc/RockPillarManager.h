@@ -17,8 +17,9 @@ public:
 	// Sets default values for this component's properties
 	URockPillarManager();
 
+	/// Parked pillars, hidden and without collision, waiting to be reused by SpawnPillar.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	TArray<ARockPillar*> Pillars;
+	TArray<ARockPillar*> PillarPool;
 
 	UStaticMeshComponent* Reticle;
 
@@ -32,12 +33,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float MaxPillarLifetime;
 
+	/// Number of pillars spawned into the pool when play begins. Uses MaxPillars when zero.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int PoolSize = 0;
+
 	UFUNCTION(BlueprintCallable)
 	bool SpawnPillar(FVector Location, FRotator Rotation, float Force, UPrimitiveComponent* Component = nullptr);
 
+	/// Returns the given pillar to the pool.
 	UFUNCTION(BlueprintCallable)
 	void DestroyPillar(ARockPillar* Pillar);
 
+	/// Returns the active pillar at the given age, 0 being the oldest.
+	UFUNCTION(BlueprintPure)
+	ARockPillar* GetActivePillar(int Index) const;
+
+	UFUNCTION(BlueprintPure)
+	int GetNumActivePillars() const { return NumActivePillars; }
+
+	/// Called by a pillar when its mesh is hidden or shown. Hidden pillars are despawned after DespawnFrameDelay frames.
+	void OnPillarVisibilityChanged(ARockPillar* Pillar);
+
+	/// Despawns the given pillar on the next tick.
+	void QueueDespawn(ARockPillar* Pillar);
+
 	UFUNCTION(BlueprintCallable)
 	void DrawReticle(FVector Location, FRotator Rotation);
 
@@ -48,9 +67,41 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Destroys the pooled pillars, active pillars are left in the world.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// Active pillars waiting on a deferred despawn. The manager only ticks while this has something in it.
+	/// Weak so a pillar destroyed from outside never leaves a dangling entry, those are pruned in the tick.
+	TSet<TWeakObjectPtr<ARockPillar>> PendingDespawns;
+
+	/// Timer set for the expiry of the oldest active pillar.
+	FTimerHandle ExpiryTimer;
+
+	/// Spawns a new pillar straight into the pool.
+	ARockPillar* SpawnPooledPillar();
+
+	/// Resizes the Pillars ring to MaxPillars, despawning the oldest pillars if there are too many.
+	void ResizeRing();
+
+	/// Removes the given pillar from the ring, keeping the rest in order. Returns false if it wasn't active.
+	bool RemoveActivePillar(ARockPillar* Pillar);
+
+	/// Sets ExpiryTimer for the oldest active pillar, or clears it if there is nothing to expire.
+	void ScheduleExpiry();
+
+	/// Despawns every pillar that has expired, then schedules the next expiry.
+	void OnPillarExpired();
+
 public:	
-	// Called every frame
+	/// Only enabled while PendingDespawns has pillars in it, counts down their DespawnFrameDelay.
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-		
+private:
+	/// Ring buffer of active pillars ordered by expiry, sized to MaxPillars. The oldest pillar is at PillarHead, use GetActivePillar() to read it in order.
+	UPROPERTY()
+	TArray<ARockPillar*> Pillars;
+
+	int PillarHead = 0;
+
+	int NumActivePillars = 0;
 };
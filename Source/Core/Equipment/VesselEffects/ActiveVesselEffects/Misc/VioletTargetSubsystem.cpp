@@ -0,0 +1,147 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VioletTargetSubsystem.h"
+#include "Engine/World.h"
+#include "../Targets/VioletVesselTarget.h"
+
+UVioletTargetSubsystem* UVioletTargetSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UVioletTargetSubsystem>() : nullptr;
+}
+
+void UVioletTargetSubsystem::RegisterTarget(UVioletVesselTarget* Target)
+{
+	if (Target && !Targets.Contains(Target))
+	{
+		Targets.Add(Target);
+		UpdateTarget(Target);
+		OnTargetRegistered.Broadcast(Target);
+	}
+}
+
+void UVioletTargetSubsystem::UnregisterTarget(UVioletVesselTarget* Target)
+{
+	if (Targets.Remove(Target) > 0)
+	{
+		RemoveFromCell(Target);
+		OnTargetUnregistered.Broadcast(Target);
+	}
+}
+
+void UVioletTargetSubsystem::UpdateTarget(UVioletVesselTarget* Target)
+{
+	FVector Location;
+	if (!Target || !GetTargetLocation(Target, Location))
+		return;
+
+	FIntVector Cell = GetCell(Location);
+	const FIntVector* CurrentCell = TargetCells.Find(Target);
+	if (!CurrentCell || *CurrentCell != Cell)
+	{
+		RemoveFromCell(Target);
+		AddToCell(Target, Cell);
+	}
+}
+
+void UVioletTargetSubsystem::GetTargetsInRange(const FVector& Origin, float Range, TArray<UVioletVesselTarget*>& OutTargets) const
+{
+	FIntVector Min = GetCell(Origin - FVector(Range));
+	FIntVector Max = GetCell(Origin + FVector(Range));
+	float RangeSquared = Range * Range;
+
+	for (int X = Min.X; X <= Max.X; X++)
+	{
+		for (int Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			for (int Z = Min.Z; Z <= Max.Z; Z++)
+			{
+				const TArray<UVioletVesselTarget*>* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (!Cell)
+					continue;
+
+				for (auto& Target : *Cell)
+				{
+					FVector Location;
+					if (GetTargetLocation(Target, Location) && (Location - Origin).SizeSquared() < RangeSquared)
+						OutTargets.Add(Target);
+				}
+			}
+		}
+	}
+}
+
+UVioletVesselTarget* UVioletTargetSubsystem::FindBestTarget(const FVector& Origin, const FVector& Direction, float Range, float ConeHalfAngle) const
+{
+	TArray<UVioletVesselTarget*> Candidates;
+	GetTargetsInRange(Origin, Range, Candidates);
+
+	FVector Forward = Direction.GetSafeNormal();
+	float BestDot = FMath::Cos(FMath::DegreesToRadians(ConeHalfAngle));
+	UVioletVesselTarget* BestTarget = nullptr;
+
+	for (auto& Target : Candidates)
+	{
+		FVector Location;
+		GetTargetLocation(Target, Location);
+
+		float Dot = FVector::DotProduct((Location - Origin).GetSafeNormal(), Forward);
+		if (Dot >= BestDot)
+		{
+			BestDot = Dot;
+			BestTarget = Target;
+		}
+	}
+	return BestTarget;
+}
+
+FIntVector UVioletTargetSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+}
+
+bool UVioletTargetSubsystem::GetTargetLocation(const UVioletVesselTarget* Target, FVector& OutLocation)
+{
+	if (Target && Target->Owner && !Target->Owner->IsPendingKill())
+	{
+		USceneComponent* TrackedComponent = Target->GetTrackedComponent();
+		if (TrackedComponent)
+		{
+			OutLocation = TrackedComponent->GetComponentLocation();
+			return true;
+		}
+	}
+	return false;
+}
+
+void UVioletTargetSubsystem::AddToCell(UVioletVesselTarget* Target, const FIntVector& Cell)
+{
+	Cells.FindOrAdd(Cell).Add(Target);
+	TargetCells.Add(Target, Cell);
+}
+
+void UVioletTargetSubsystem::RemoveFromCell(UVioletVesselTarget* Target)
+{
+	FIntVector Cell;
+	if (TargetCells.RemoveAndCopyValue(Target, Cell))
+	{
+		TArray<UVioletVesselTarget*>* Bucket = Cells.Find(Cell);
+		if (Bucket)
+		{
+			Bucket->RemoveSwap(Target);
+			if (Bucket->Num() == 0)
+				Cells.Remove(Cell);
+		}
+	}
+}
+
+void UVioletTargetSubsystem::Deinitialize()
+{
+	Targets.Empty();
+	Cells.Empty();
+	TargetCells.Empty();
+	OnTargetRegistered.Clear();
+	OnTargetUnregistered.Clear();
+
+	Super::Deinitialize();
+}
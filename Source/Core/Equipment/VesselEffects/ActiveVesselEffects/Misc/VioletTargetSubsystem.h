@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VioletTargetSubsystem.generated.h"
+
+class UVioletVesselTarget;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVioletTargetChanged, UVioletVesselTarget*);
+
+/// Keeps track of every Violet target in the world. Targets register themselves on BeginPlay and unregister on EndPlay,
+/// so targets in streamed sublevels or spawned at runtime are picked up without scanning the level.
+/// Registered targets are also bucketed into a uniform grid, so range and view cone queries only look at nearby cells.
+UCLASS()
+class SPEEGYPT_API UVioletTargetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// Returns the subsystem of the given world, or nullptr if there isn't one.
+	static UVioletTargetSubsystem* Get(const UWorld* World);
+
+	void RegisterTarget(UVioletVesselTarget* Target);
+
+	void UnregisterTarget(UVioletVesselTarget* Target);
+
+	const TArray<UVioletVesselTarget*>& GetTargets() const { return Targets; }
+
+	/// Moves the target to the grid cell of its tracked component's current location. Called by targets when that component moves.
+	void UpdateTarget(UVioletVesselTarget* Target);
+
+	/// Fills OutTargets with every target whose tracked component is within Range of Origin.
+	void GetTargetsInRange(const FVector& Origin, float Range, TArray<UVioletVesselTarget*>& OutTargets) const;
+
+	/// Returns the target within Range closest to the middle of the view cone, or nullptr if none are inside it.
+	UVioletVesselTarget* FindBestTarget(const FVector& Origin, const FVector& Direction, float Range, float ConeHalfAngle) const;
+
+	/// Size of a grid cell, roughly the Violet effect range so a range query only touches the neighbouring cells.
+	float CellSize = 2000.f;
+
+	/// Broadcast after a target has been registered.
+	FOnVioletTargetChanged OnTargetRegistered;
+
+	/// Broadcast after a target has been unregistered.
+	FOnVioletTargetChanged OnTargetUnregistered;
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	UPROPERTY()
+	TArray<UVioletVesselTarget*> Targets;
+
+	/// Targets bucketed by the grid cell their tracked component is in.
+	TMap<FIntVector, TArray<UVioletVesselTarget*>> Cells;
+
+	/// Cell each registered target is currently in.
+	TMap<UVioletVesselTarget*, FIntVector> TargetCells;
+
+	FIntVector GetCell(const FVector& Location) const;
+
+	/// Returns the location the target is indexed by, see UVioletVesselTarget::GetTrackedComponent.
+	static bool GetTargetLocation(const UVioletVesselTarget* Target, FVector& OutLocation);
+
+	void AddToCell(UVioletVesselTarget* Target, const FIntVector& Cell);
+
+	void RemoveFromCell(UVioletVesselTarget* Target);
+};
@@ -19,31 +19,58 @@ void UVioletTargetTracker::BeginPlay()
 {
 	Super::BeginPlay();
 
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+	{
+		Subsystem->OnTargetRegistered.AddUObject(this, &UVioletTargetTracker::OnTargetRegistered);
+		Subsystem->OnTargetUnregistered.AddUObject(this, &UVioletTargetTracker::OnTargetUnregistered);
+	}
 	UpdateTargets();
-	
 }
 
-void UVioletTargetTracker::UpdateTargets()
+void UVioletTargetTracker::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	UWorld* World = GetWorld();
-	if (World)
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
 	{
-		ULevel* Level = World->GetCurrentLevel();
-		if (Level)
-		{
-			for (auto& Actor : Level->Actors)
-			{
-				if (Actor)
-				{
-					UActorComponent* TargetToAdd = Actor->GetComponentByClass(UVioletVesselTarget::StaticClass());
-					if (TargetToAdd)
-					{
-						UVioletVesselTarget* PureTargetToAdd = Cast<UVioletVesselTarget>(TargetToAdd);
-						if (PureTargetToAdd)
-							VioletTargets.Add(PureTargetToAdd);
-					}
-				}
-			}
-		}
+		Subsystem->OnTargetRegistered.RemoveAll(this);
+		Subsystem->OnTargetUnregistered.RemoveAll(this);
 	}
+	VioletTargets.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVioletTargetTracker::UpdateTargets()
+{
+	VioletTargets.Reset();
+
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+		VioletTargets.Append(Subsystem->GetTargets());
+}
+
+void UVioletTargetTracker::OnTargetRegistered(UVioletVesselTarget* Target)
+{
+	VioletTargets.AddUnique(Target);
+}
+
+void UVioletTargetTracker::OnTargetUnregistered(UVioletVesselTarget* Target)
+{
+	VioletTargets.Remove(Target);
+}
+
+TArray<UVioletVesselTarget*> UVioletTargetTracker::GetTargetsInRange(FVector Origin, float Range) const
+{
+	TArray<UVioletVesselTarget*> Targets;
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->GetTargetsInRange(Origin, Range, Targets);
+	return Targets;
+}
+
+UVioletVesselTarget* UVioletTargetTracker::FindBestTarget(FVector Origin, FVector Direction, float Range, float ConeHalfAngle) const
+{
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	return Subsystem ? Subsystem->FindBestTarget(Origin, Direction, Range, ConeHalfAngle) : nullptr;
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "../Targets/VioletVesselTarget.h"
+#include "VioletTargetSubsystem.h"
 #include "VioletTargetTracker.generated.h"
 
 
@@ -17,13 +18,29 @@ public:
 	// Sets default values for this component's properties
 	UVioletTargetTracker();
 
+	/// Every Violet target currently in the world, kept up to date by the UVioletTargetSubsystem.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TArray<UVioletVesselTarget*> VioletTargets;
 
+	/// Copies the registered targets from the UVioletTargetSubsystem.
 	UFUNCTION(BlueprintCallable)
 	void UpdateTargets();
 
+	/// Returns every target within Range of Origin, using the subsystem's grid.
+	UFUNCTION(BlueprintCallable)
+	TArray<UVioletVesselTarget*> GetTargetsInRange(FVector Origin, float Range) const;
+
+	/// Returns the target within Range closest to the middle of the view cone, for reticle and aim assist selection.
+	UFUNCTION(BlueprintCallable)
+	UVioletVesselTarget* FindBestTarget(FVector Origin, FVector Direction, float Range, float ConeHalfAngle) const;
+
 protected:
 	// Called when the game starts
-	virtual void BeginPlay() override;		
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void OnTargetRegistered(UVioletVesselTarget* Target);
+
+	void OnTargetUnregistered(UVioletVesselTarget* Target);
 };
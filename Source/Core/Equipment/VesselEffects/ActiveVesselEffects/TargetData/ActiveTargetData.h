@@ -15,4 +15,13 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
 	bool active;
 
-};
\ No newline at end of file
+};
+
+USTRUCT(BlueprintType)
+struct FActiveComponentData : public FTargetComponentData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	bool active = false;
+};
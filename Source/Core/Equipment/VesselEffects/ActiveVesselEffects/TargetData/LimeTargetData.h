@@ -27,6 +27,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float CurrentCharge = 0;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float ChargeUpdateTime = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MaxCharge = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ChargeRate = 0.33;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float DepleteRate = 0.33;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float DepleteOverTimeRate = 0.33;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bDepletesOverTime = false;
+};
+
+USTRUCT(BlueprintType)
+struct FLimeComponentData : public FActiveComponentData
+{
+	GENERATED_BODY()
+
+	/// Change through ULimeVesselTarget::SetChargingState so the target can reschedule its threshold timer.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	EChargingState ChargingState = EChargingState::Idle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float CurrentCharge = 0;
+
+	/// World time CurrentCharge was last brought up to date. The charge since then follows from the rate of ChargingState.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float ChargeUpdateTime = 0;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float MaxCharge = 1;
 
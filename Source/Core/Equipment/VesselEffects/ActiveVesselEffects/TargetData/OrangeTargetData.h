@@ -18,3 +18,12 @@ public:
 		bool orange = false;
 
 };
+
+USTRUCT(BlueprintType)
+struct FOrangeComponentData : public FActiveComponentData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool orange = false;
+};
@@ -19,3 +19,13 @@ public:
 
 
 };
+
+USTRUCT(BlueprintType)
+struct FVioletComponentData : public FActiveComponentData
+{
+	GENERATED_BODY()
+
+	/// Material the component had at BeginPlay, put back when the reticle is hidden.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	UMaterialInterface* BaseMat = nullptr;
+};
@@ -18,3 +18,9 @@ public:
 	bool temp;
 		
 };
+
+USTRUCT(BlueprintType)
+struct FVioletTeleportComponentData : public FActiveComponentData
+{
+	GENERATED_BODY()
+};
@@ -2,14 +2,11 @@
 
 
 #include "ActiveVesselTarget.h"
+#include "../Misc/AimQuerySubsystem.h"
 
 // Sets default values for this component's properties
 UActiveVesselTarget::UActiveVesselTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	// ...
 }
 
@@ -23,6 +20,24 @@ void UActiveVesselTarget::BeginPlay()
 	
 }
 
+void UActiveVesselTarget::OnRegister()
+{
+	Super::OnRegister();
+
+	UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+	if (AimQuery)
+		AimQuery->InvalidateTargets(GetOwner());
+}
+
+void UActiveVesselTarget::OnUnregister()
+{
+	UAimQuerySubsystem* AimQuery = UAimQuerySubsystem::Get(GetWorld());
+	if (AimQuery)
+		AimQuery->InvalidateTargets(GetOwner());
+
+	Super::OnUnregister();
+}
+
 
 // Called every frame
 void UActiveVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -25,6 +25,11 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Drops the owner from the UAimQuerySubsystem target cache, so targets added or removed at runtime are picked up.
+	virtual void OnRegister() override;
+
+	virtual void OnUnregister() override;
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
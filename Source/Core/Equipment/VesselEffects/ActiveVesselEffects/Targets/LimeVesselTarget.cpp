@@ -3,6 +3,10 @@
 
 #include "LimeVesselTarget.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../../HelperFiles/VesselStats.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Lime Target Tick"), STAT_LimeVesselTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 ULimeVesselTarget::ULimeVesselTarget()
@@ -10,14 +14,14 @@ ULimeVesselTarget::ULimeVesselTarget()
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
 	Init();
 }
 
 void ULimeVesselTarget::Init()
 {
-	DataEntryPrefix = "LimeData_";
-	DataType = ULimeTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(ULimeVesselTarget, LimeData);
 	CollisionChannel = LIME_CHANNEL;
 	Super::Init();
 }
@@ -27,62 +31,128 @@ void ULimeVesselTarget::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
-	
+	float Now = GetTime();
+	for (auto& Data : LimeData)
+		Data.ChargeUpdateTime = Now;
+	ScheduleNextThreshold();
 }
 
+void ULimeVesselTarget::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GetWorld())
+		GetWorld()->GetTimerManager().ClearTimer(ThresholdTimer);
 
-// Called every frame
+	Super::EndPlay(EndPlayReason);
+}
+
+// Only ticks while a charge is changing and bUpdateChargeEveryFrame is set
 void ULimeVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_LimeVesselTargetTick, LimeVesselTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	for (auto& Component : PrimitiveComponents)
+	float Now = GetTime();
+	for (auto& Data : LimeData)
+	{
+		SettleCharge(Data, Now);
+		//SCREENMSGF("Charge: ", Data.CurrentCharge);
+	}
+}
+
+void ULimeVesselTarget::SetChargingState(UPrimitiveComponent* Component, EChargingState State)
+{
+	FLimeComponentData* Data = GetDataOfComponentAs<FLimeComponentData>(Component);
+	if (Data)
+	{
+		SettleCharge(*Data, GetTime());
+		Data->ChargingState = State;
+		ScheduleNextThreshold();
+	}
+}
+
+float ULimeVesselTarget::GetCharge(UPrimitiveComponent* Component)
+{
+	FLimeComponentData* Data = GetDataOfComponentAs<FLimeComponentData>(Component);
+	return Data ? GetCharge(*Data) : 0;
+}
+
+float ULimeVesselTarget::GetCharge(const FLimeComponentData& Data) const
+{
+	float Rate = GetChargeRate(Data);
+	if (Rate == 0)
+		return Data.CurrentCharge;
+
+	return FMath::Clamp(Data.CurrentCharge + Rate * (GetTime() - Data.ChargeUpdateTime), 0.f, Data.MaxCharge);
+}
+
+float ULimeVesselTarget::GetChargeRate(const FLimeComponentData& Data) const
+{
+	switch (Data.ChargingState)
+	{
+	case EChargingState::Idle:
+		return Data.bDepletesOverTime ? -Data.DepleteOverTimeRate : 0;
+	case EChargingState::Charging:
+		return Data.ChargeRate;
+	case EChargingState::Depleteing:
+		return -Data.DepleteRate;
+	}
+	return 0;
+}
+
+void ULimeVesselTarget::SettleCharge(FLimeComponentData& Data, float Time)
+{
+	float Rate = GetChargeRate(Data);
+	float OldCharge = Data.CurrentCharge;
+	if (Rate != 0)
+		Data.CurrentCharge = FMath::Clamp(OldCharge + Rate * (Time - Data.ChargeUpdateTime), 0.f, Data.MaxCharge);
+	Data.ChargeUpdateTime = Time;
+
+	if (Rate > 0 && OldCharge < Data.MaxCharge && Data.CurrentCharge >= Data.MaxCharge)
+		OnFullyCharged.Broadcast(Data.Component);
+	else if (Rate < 0 && OldCharge > 0 && Data.CurrentCharge <= 0)
+		OnFullyDrained.Broadcast(Data.Component);
+}
+
+void ULimeVesselTarget::ScheduleNextThreshold()
+{
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld())
+		return;
+
+	// Time until the soonest component reaches full or empty at its current rate
+	float NextThreshold = -1;
+	for (auto& Data : LimeData)
 	{
-		if (Component)
-		{
-			ULimeTargetData* PureComponent = Cast<ULimeTargetData>(Component);
-			if (PureComponent)
-			{
-				switch (PureComponent->ChargingState)
-				{
-				case EChargingState::Idle:
-					if (PureComponent->bDepletesOverTime)
-					{
-						if (PureComponent->CurrentCharge > 0)
-						{
-							PureComponent->CurrentCharge -= PureComponent->DepleteOverTimeRate * DeltaTime;
-						}
-						if (PureComponent->CurrentCharge <= 0)
-						{
-							PureComponent->CurrentCharge = 0;
-						}
-					}
-					break;
-				case EChargingState::Charging:
-					if (PureComponent->CurrentCharge < PureComponent->MaxCharge)
-					{
-						PureComponent->CurrentCharge += PureComponent->ChargeRate * DeltaTime;
-					}
-					if (PureComponent->CurrentCharge >= PureComponent->MaxCharge)
-					{
-						PureComponent->CurrentCharge = PureComponent->MaxCharge;
-					}
-					break;
-				case EChargingState::Depleteing:
-					if (PureComponent->CurrentCharge > 0)
-					{
-						PureComponent->CurrentCharge -= PureComponent->DepleteRate * DeltaTime;
-					}
-					if (PureComponent->CurrentCharge <= 0)
-					{
-						PureComponent->CurrentCharge = 0;
-					}
-					break;
-				}
-				//SCREENMSGF("Charge: ", PureComponent->CurrentCharge);
-			}
-		}
+		float Rate = GetChargeRate(Data);
+		float Charge = GetCharge(Data);
+		float TimeToThreshold = -1;
+		if (Rate > 0 && Charge < Data.MaxCharge)
+			TimeToThreshold = (Data.MaxCharge - Charge) / Rate;
+		else if (Rate < 0 && Charge > 0)
+			TimeToThreshold = Charge / -Rate;
+
+		if (TimeToThreshold >= 0 && (NextThreshold < 0 || TimeToThreshold < NextThreshold))
+			NextThreshold = TimeToThreshold;
 	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	TimerManager.ClearTimer(ThresholdTimer);
+	if (NextThreshold >= 0)
+		TimerManager.SetTimer(ThresholdTimer, this, &ULimeVesselTarget::OnThresholdReached, FMath::Max(NextThreshold, KINDA_SMALL_NUMBER), false);
+
+	SetComponentTickEnabled(bUpdateChargeEveryFrame && NextThreshold >= 0);
 }
 
+void ULimeVesselTarget::OnThresholdReached()
+{
+	float Now = GetTime();
+	for (auto& Data : LimeData)
+		SettleCharge(Data, Now);
+	ScheduleNextThreshold();
+}
+
+float ULimeVesselTarget::GetTime() const
+{
+	return GetWorld() ? GetWorld()->GetTimeSeconds() : 0;
+}
@@ -7,6 +7,7 @@
 #include "ActiveVesselTarget.h"
 #include "LimeVesselTarget.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLimeChargeDelegate, UPrimitiveComponent*, Component);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SPEEGYPT_API ULimeVesselTarget : public UActiveVesselTarget
@@ -19,12 +20,58 @@ public:
 
 	void Init() override;
 
+	/// Settings and charge of each of the owner's components.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FLimeComponentData> LimeData;
+
+	/// Keeps CurrentCharge up to date every frame while a component is charging or draining. Blueprints such as BP_MovingPlatform read it directly.
+	/// Turn it off on targets nothing reads it from, CurrentCharge is then only brought up to date on state changes and when a threshold is
+	/// reached, use GetCharge for the live value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bUpdateChargeEveryFrame = true;
+
+	/// Broadcast when a component's charge reaches MaxCharge.
+	UPROPERTY(BlueprintAssignable)
+	FLimeChargeDelegate OnFullyCharged;
+
+	/// Broadcast when a component's charge runs out.
+	UPROPERTY(BlueprintAssignable)
+	FLimeChargeDelegate OnFullyDrained;
+
+	/// Brings the charge of the component up to date, switches its state and schedules the next threshold.
+	UFUNCTION(BlueprintCallable)
+	void SetChargingState(UPrimitiveComponent* Component, EChargingState State);
+
+	/// Returns the charge of the component right now, without waiting for it to be brought up to date.
+	UFUNCTION(BlueprintCallable)
+	float GetCharge(UPrimitiveComponent* Component);
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// Set for the next time a component becomes fully charged or drained.
+	FTimerHandle ThresholdTimer;
+
+	/// Rate the charge changes at in the component's current state.
+	float GetChargeRate(const FLimeComponentData& Data) const;
+
+	float GetCharge(const FLimeComponentData& Data) const;
+
+	/// Moves CurrentCharge up to the given time and broadcasts any threshold it crossed on the way.
+	void SettleCharge(FLimeComponentData& Data, float Time);
+
+	/// Sets ThresholdTimer for the soonest threshold, and only ticks while a charge is changing and bUpdateChargeEveryFrame is set.
+	void ScheduleNextThreshold();
+
+	void OnThresholdReached();
+
+	float GetTime() const;
+
 public:	
-	// Called every frame
+	/// Only enabled while a charge is changing and bUpdateChargeEveryFrame is set.
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 		
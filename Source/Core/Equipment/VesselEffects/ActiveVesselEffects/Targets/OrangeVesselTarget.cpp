@@ -6,17 +6,12 @@
 // Sets default values for this component's properties
 UOrangeVesselTarget::UOrangeVesselTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	Init();
 }
 
 void UOrangeVesselTarget::Init()
 {
-	DataEntryPrefix = "OrangeData_";
-	DataType = UOrangeTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UOrangeVesselTarget, OrangeData);
 	CollisionChannel = ORANGE_CHANNEL;
 	Super::Init();
 }
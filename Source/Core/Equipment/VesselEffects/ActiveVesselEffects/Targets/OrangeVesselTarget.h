@@ -19,6 +19,10 @@ public:
 
 	void Init() override;
 
+	/// Settings of each of the owner's components.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FOrangeComponentData> OrangeData;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -6,17 +6,12 @@
 // Sets default values for this component's properties
 UVioletTeleportTarget::UVioletTeleportTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	Init();
 }
 
 void UVioletTeleportTarget::Init()
 {
-	DataEntryPrefix = "VioletTeleportData_";
-	DataType = UVioletTeleportData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UVioletTeleportTarget, TeleportData);
 	CollisionChannel = VIOLET_EFFECT;
 	Super::Init();
 }
@@ -28,20 +23,12 @@ void UVioletTeleportTarget::BeginPlay()
 
 	if (Owner)
 	{
-		for (auto& Component : PrimitiveComponents)
+		for (auto& Data : TeleportData)
 		{
-			if (Component)
+			if (Data.Component && Data.bIsAffectedByThisEffect)
 			{
-				UVioletTeleportData* PureComponent = Cast<UVioletTeleportData>(Component);
-				if (PureComponent && PureComponent->bIsAffectedByThisEffect)
-				{
-					UPrimitiveComponent* Primitive = GetComponentByName(PureComponent->ComponentName);
-					if (Primitive)
-					{
-						Primitive->SetMobility(EComponentMobility::Movable);
-						Primitive->SetSimulatePhysics(true);
-					}
-				}
+				Data.Component->SetMobility(EComponentMobility::Movable);
+				Data.Component->SetSimulatePhysics(true);
 			}
 		}
 	}
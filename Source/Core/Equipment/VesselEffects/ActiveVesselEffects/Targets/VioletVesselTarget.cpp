@@ -3,6 +3,7 @@
 
 #include "VioletVesselTarget.h"
 #include "UObject/ConstructorHelpers.h"
+#include "../Misc/VioletTargetSubsystem.h"
 
 #define VIOLET_EFFECT ECC_GameTraceChannel7
 #define FIND_SPOT_CHANNEL ECC_GameTraceChannel9
@@ -10,10 +11,6 @@
 // Sets default values for this component's properties
 UVioletVesselTarget::UVioletVesselTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	static ConstructorHelpers::FObjectFinder<UMaterial> MatFinder(TEXT("Material'/Game/Speegypt/Environment/Materials/MAT_VioletReticle.MAT_VioletReticle'"));
 	if (MatFinder.Object)
 		RetMat = MatFinder.Object;
@@ -23,11 +20,10 @@ UVioletVesselTarget::UVioletVesselTarget()
 
 void UVioletVesselTarget::Init()
 {
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UVioletVesselTarget, VioletData);
 	if (GetOwner())
 	{
 
-		DataEntryPrefix = "VioletData_";
-		DataType = UVioletTargetData::StaticClass();
 		CollisionChannel = VIOLET_CHANNEL;
 
 		PlayerSpawnLocation = CreateDefaultSubobject<USceneComponent>(TEXT("Player Spawn Loaction"));
@@ -47,22 +43,51 @@ void UVioletVesselTarget::Init()
 void UVioletVesselTarget::BeginPlay()
 {
 	Super::BeginPlay();
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Data : VioletData)
 	{
-		if (Component->bIsAffectedByThisEffect)
+		if (Data.Component && Data.bIsAffectedByThisEffect)
 		{
-			UPrimitiveComponent* Primitive = GetComponentByName(Component->ComponentName);
-			if (Primitive)
-			{
-				UVioletTargetData* PureComponent = Cast<UVioletTargetData>(Component);
-				if(PureComponent)
-					PureComponent->BaseMat = Primitive->GetMaterial(0);
-				Primitive->SetCollisionResponseToChannel(FIND_SPOT_CHANNEL, ECR_Ignore);
-				Primitive->SetCollisionResponseToChannel(VIOLET_EFFECT, ECR_Ignore);
-				Primitive->SetMobility(EComponentMobility::Movable);
-			}
+			Data.BaseMat = Data.Component->GetMaterial(0);
+			Data.Component->SetCollisionResponseToChannel(FIND_SPOT_CHANNEL, ECR_Ignore);
+			Data.Component->SetCollisionResponseToChannel(VIOLET_EFFECT, ECR_Ignore);
+			Data.Component->SetMobility(EComponentMobility::Movable);
 		}
 	}
+
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->RegisterTarget(this);
+
+	USceneComponent* TrackedComponent = GetTrackedComponent();
+	if (TrackedComponent)
+		TrackedComponent->TransformUpdated.AddUObject(this, &UVioletVesselTarget::OnTrackedTransformUpdated);
+}
+
+void UVioletVesselTarget::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	USceneComponent* TrackedComponent = GetTrackedComponent();
+	if (TrackedComponent)
+		TrackedComponent->TransformUpdated.RemoveAll(this);
+
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->UnregisterTarget(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+USceneComponent* UVioletVesselTarget::GetTrackedComponent() const
+{
+	if (CaptureCapsule)
+		return CaptureCapsule;
+	return Owner ? Owner->GetRootComponent() : nullptr;
+}
+
+void UVioletVesselTarget::OnTrackedTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UVioletTargetSubsystem* Subsystem = UVioletTargetSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->UpdateTarget(this);
 }
 
 
@@ -78,13 +103,10 @@ void UVioletVesselTarget::DrawReticle()
 {
 	if (Owner)
 	{
-		for (auto& Component : PrimitiveComponents)
+		for (auto& Data : VioletData)
 		{
-			if (Component && Component->bIsAffectedByThisEffect)
-			{
-				UPrimitiveComponent* Primitive = GetComponentByName(Component->ComponentName);
-				Primitive->SetMaterial(0, RetMat);
-			}
+			if (Data.Component && Data.bIsAffectedByThisEffect)
+				Data.Component->SetMaterial(0, RetMat);
 		}
 	}
 }
@@ -93,17 +115,10 @@ void UVioletVesselTarget::HideReticle()
 {
 	if (Owner)
 	{
-		for (auto& Component : PrimitiveComponents)
+		for (auto& Data : VioletData)
 		{
-			if (Component && Component->bIsAffectedByThisEffect)
-			{
-				UVioletTargetData* PureComponent = Cast<UVioletTargetData>(Component);
-				if (PureComponent)
-				{
-					UPrimitiveComponent* Primitive = GetComponentByName(PureComponent->ComponentName);
-					Primitive->SetMaterial(0, PureComponent->BaseMat);
-				}
-			}
+			if (Data.Component && Data.bIsAffectedByThisEffect)
+				Data.Component->SetMaterial(0, Data.BaseMat);
 		}
 	}
 }
@@ -20,6 +20,10 @@ public:
 
 	void Init() override;
 
+	/// Settings of each of the owner's components, BaseMat is filled in on BeginPlay.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FVioletComponentData> VioletData;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UCapsuleComponent* CaptureCapsule;
 
@@ -30,12 +34,22 @@ public:
 		USceneComponent* PlayerSpawnLocation;
 	void DrawReticle();
 
+	/// Component the UVioletTargetSubsystem indexes this target by, the capture capsule the swap happens around. Falls back to the owner's root.
+	USceneComponent* GetTrackedComponent() const;
+
 	void HideReticle();
 
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Unregisters the target from the UVioletTargetSubsystem.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// Bound to the tracked component's TransformUpdated event so the subsystem's grid follows the target when it moves.
+	/// Children broadcast it too when a parent moves, so this covers the owner moving as well as the component itself.
+	void OnTrackedTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
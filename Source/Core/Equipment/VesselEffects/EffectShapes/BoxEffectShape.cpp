@@ -5,13 +5,7 @@
 
 UBoxEffectShape::UBoxEffectShape()
 {
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EffectShapeMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsCube.SM_EffectsCube'"));
-	if (EffectShapeMeshFinder.Object)
-	{
-		EffectShapeMesh->SetStaticMesh(EffectShapeMeshFinder.Object);
-		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		EffectShapeMesh->SetupAttachment(this);
-	}
+	;
 }
 
 void UBoxEffectShape::SetupMesh()
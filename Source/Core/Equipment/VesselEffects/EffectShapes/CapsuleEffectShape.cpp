@@ -2,27 +2,11 @@
 
 
 #include "CapsuleEffectShape.h"
+#include "../../VesselColorRegistry.h"
 
 UCapsuleEffectShape::UCapsuleEffectShape()
 {
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EffectShapeMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule.SM_EffectsCapsule'"));
-	if (EffectShapeMeshFinder.Object)
-	{
-		EffectShapeMesh->SetStaticMesh(EffectShapeMeshFinder.Object);
-		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		EffectShapeMesh->SetupAttachment(this);
-		TwoToOne = EffectShapeMeshFinder.Object;
-	}
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> ThreeToOneMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule_750_250.SM_EffectsCapsule_750_250'"));
-	if (ThreeToOneMeshFinder.Object)
-	{
-		ThreeToOne = ThreeToOneMeshFinder.Object;
-	}
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EightToOneMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsCapsule_800_100.SM_EffectsCapsule_800_100'"));
-	if (EightToOneMeshFinder.Object)
-	{
-		EightToOne = EightToOneMeshFinder.Object;
-	}
+	;
 }
 
 void UCapsuleEffectShape::UpdateDecalVectors()
@@ -52,9 +36,9 @@ void UCapsuleEffectShape::UpdateDecalVectors()
 		Start = GetComponentLocation() + Up * (ScaledHeight - ScaledRadius);
 		End = GetComponentLocation() - Up * (ScaledHeight - ScaledRadius);
 
-		DecalDynamicMat->SetScalarParameterValue("Radius", ScaledRadius);
-		DecalDynamicMat->SetVectorParameterValue("Start", Start);
-		DecalDynamicMat->SetVectorParameterValue("End", End);
+		SetDecalScalar("Radius", ScaledRadius);
+		SetDecalVector("Start", Start);
+		SetDecalVector("End", End);
 	}
 }
 
@@ -63,18 +47,9 @@ void UCapsuleEffectShape::SetMeshType(EEffectCapsuleType NewType)
 	if (EffectShapeMesh)
 	{
 		MeshType = NewType;
-		switch (MeshType)
-		{
-		case EEffectCapsuleType::TwoToOne:
-			EffectShapeMesh->SetStaticMesh(TwoToOne);
-			break;
-		case EEffectCapsuleType::ThreeToOne:
-			EffectShapeMesh->SetStaticMesh(ThreeToOne);
-			break;
-		case EEffectCapsuleType::EightToOne:
-			EffectShapeMesh->SetStaticMesh(EightToOne);
-			break;
-		}
+		UStaticMesh* ShapeMesh = UVesselColorRegistry::Get()->GetCapsuleMesh(MeshType);
+		if (ShapeMesh)
+			EffectShapeMesh->SetStaticMesh(ShapeMesh);
 	}
 }
 
@@ -28,15 +28,6 @@ public:
 	UPROPERTY()
 	EEffectCapsuleType MeshType;
 
-	UPROPERTY()
-	UStaticMesh* TwoToOne;
-
-	UPROPERTY()
-	UStaticMesh* ThreeToOne;
-
-	UPROPERTY()
-	UStaticMesh* EightToOne;
-
 	//virtual void BeginPlay() override;
 
 	//void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -5,14 +5,7 @@
 
 UConeEffectShape::UConeEffectShape()
 {
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EffectShapeMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsCone.SM_EffectsCone'"));
-	if (EffectShapeMeshFinder.Object)
-	{
-		EffectShapeMesh->SetStaticMesh(EffectShapeMeshFinder.Object);
-		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		EffectShapeMesh->SetupAttachment(this);
-		EffectShapeMesh->SetUsingAbsoluteRotation(false);
-	}
+	EffectShapeMesh->SetUsingAbsoluteRotation(false);
 }
 
 void UConeEffectShape::SetupMesh()
@@ -32,12 +25,12 @@ void UConeEffectShape::SetupMesh()
 
 void UConeEffectShape::UpdateDecalVectors()
 {
-	if (EffectShapeMesh)
+	if (EffectShapeMesh && DecalDynamicMat)
 	{
-		DecalDynamicMat->SetScalarParameterValue("ConeHeight", EffectShapeMesh->GetComponentScale().Z * 1000);
-		DecalDynamicMat->SetScalarParameterValue("BaseRadius", EffectShapeMesh->GetComponentScale().X * 500);
-		DecalDynamicMat->SetVectorParameterValue("Start", EffectShapeMesh->GetComponentLocation());
-		DecalDynamicMat->SetVectorParameterValue("TipToBase", -EffectShapeMesh->GetUpVector());
+		SetDecalScalar("ConeHeight", EffectShapeMesh->GetComponentScale().Z * 1000);
+		SetDecalScalar("BaseRadius", EffectShapeMesh->GetComponentScale().X * 500);
+		SetDecalVector("Start", EffectShapeMesh->GetComponentLocation());
+		SetDecalVector("TipToBase", -EffectShapeMesh->GetUpVector());
 	}
 	
 }
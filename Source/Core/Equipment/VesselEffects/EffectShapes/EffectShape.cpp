@@ -15,26 +15,12 @@ UEffectShape::UEffectShape()
 	Decal->SetVisibility(false);
 	Decal->SetHiddenInGame(true);
 
+	// The mesh, glow and decal materials are set from the UVesselColorRegistry by the owning effect when it registers
 	EffectShapeMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("EffectShapeMesh"));
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EffectShapeMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsSphere.SM_EffectsSphere'"));
-	if (EffectShapeMeshFinder.Object)
-	{
-		EffectShapeMesh->SetStaticMesh(EffectShapeMeshFinder.Object);
-		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		EffectShapeMesh->SetupAttachment(this);
-		EffectShapeMesh->SetUsingAbsoluteScale(true);
-		EffectShapeMesh->CastShadow = false;
-	}
-	static ConstructorHelpers::FObjectFinder<UMaterialInstance> GlowMatFinder(TEXT("MaterialInstanceConstant'/Game/Speegypt/Effects/Materials/MAT_DefaultGlow_Inst.MAT_DefaultGlow_Inst'"));
-	if (GlowMatFinder.Object)
-	{
-		GlowMat = GlowMatFinder.Object;
-		if (EffectShapeMesh)
-			EffectShapeMesh->SetMaterial(0, GlowMat);
-	}
-	static ConstructorHelpers::FObjectFinder<UMaterial> DecalMatFinder(TEXT("Material'/Game/Speegypt/Effects/Materials/MAT_DefaultDecal.MAT_DefaultDecal'"));
-	if (DecalMatFinder.Object)
-		DecalMat = DecalMatFinder.Object;
+	EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	EffectShapeMesh->SetupAttachment(this);
+	EffectShapeMesh->SetUsingAbsoluteScale(true);
+	EffectShapeMesh->CastShadow = false;
 	Decal->SetUsingAbsoluteScale(true);
 
 	Disable();
@@ -48,7 +34,11 @@ void UEffectShape::Enable()
 		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 		Decal->SetHiddenInGame(false);
 	}
-	SetComponentTickEnabled(true);
+	bIsEnabled = true;
+	SetComponentTickEnabled(EffectSwapState != EEffectSwapState::Idle);
+
+	if (bBegunPlay)
+		UpdateDecalVectors();
 }
 
 void UEffectShape::Disable()
@@ -59,6 +49,7 @@ void UEffectShape::Disable()
 		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		Decal->SetHiddenInGame(true);
 	}
+	bIsEnabled = false;
 	SetComponentTickEnabled(false);
 }
 
@@ -74,15 +65,9 @@ void UEffectShape::StartSwap(bool bStartGrowing)
 		SwapTimer = MaxSwapTimer;
 		EffectSwapState = EEffectSwapState::Shrinking;
 	}
-}
 
-void UEffectShape::Terminate()
-{
-	if(EffectShapeMesh)
-		EffectShapeMesh->DestroyComponent();
-	if(Decal)
-		Decal->DestroyComponent();
-	DestroyComponent();
+	if (bIsEnabled)
+		SetComponentTickEnabled(true);
 }
 
 void UEffectShape::BeginPlay()
@@ -92,8 +77,20 @@ void UEffectShape::BeginPlay()
 	SetupMesh();
 
 	bBegunPlay = true;
+
+	if (EffectShapeMesh)
+		EffectShapeMesh->TransformUpdated.AddUObject(this, &UEffectShape::OnMeshTransformUpdated);
+}
+
+void UEffectShape::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (EffectShapeMesh)
+		EffectShapeMesh->TransformUpdated.RemoveAll(this);
+
+	Super::EndPlay(EndPlayReason);
 }
 
+// Only ticks while a swap is being animated, and goes back to sleep once the shape is idle.
 void UEffectShape::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -103,25 +100,37 @@ void UEffectShape::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
 		switch (EffectSwapState)
 		{
 		case EEffectSwapState::Shrinking:
-			EffectShapeMesh->SetWorldScale3D(FVector(FMath::Lerp(MinMeshScale, MaxMeshScale, SwapTimer / MaxSwapTimer)));
 			SwapTimer -= DeltaTime;
 			if (SwapTimer <= 0)
 			{
+				SwapTimer = 0;
 				EffectSwapState = EEffectSwapState::Growing;
 				OnStartGrowing.Broadcast();
 			}
 			break;
 		case EEffectSwapState::Growing:
-			EffectShapeMesh->SetWorldScale3D(FVector(FMath::Lerp(MinMeshScale, MaxMeshScale, SwapTimer / MaxSwapTimer)));
 			SwapTimer += DeltaTime;
 			if (SwapTimer >= MaxSwapTimer)
+			{
+				SwapTimer = MaxSwapTimer;
 				EffectSwapState = EEffectSwapState::Idle;
+			}
 			break;
 		default:
 			break;
 		}
-		UpdateDecalVectors();
+
+		float Alpha = FMath::Clamp(SwapTimer / MaxSwapTimer, 0.0f, 1.0f);
+		if (SwapCurve)
+			Alpha = SwapCurve->GetFloatValue(Alpha);
+
+		FVector NewScale = FVector(FMath::Lerp(MinMeshScale, MaxMeshScale, Alpha));
+		if (!NewScale.Equals(EffectShapeMesh->GetComponentScale()))
+			EffectShapeMesh->SetWorldScale3D(NewScale);
 	}
+
+	if (EffectSwapState == EEffectSwapState::Idle)
+		SetComponentTickEnabled(false);
 }
 
 void UEffectShape::SetupMesh()
@@ -136,6 +145,8 @@ void UEffectShape::SetupMesh()
 		if (DynamicMat)
 		{
 			DecalDynamicMat = DynamicMat;
+			DecalScalarValues.Reset();
+			DecalVectorValues.Reset();
 			DecalDynamicMat->SetVectorParameterValue("Color", DecalColor);
 		}
 		Decal->DecalSize = EffectShapeMesh->Bounds.BoxExtent + EffectShapeMesh->Bounds.BoxExtent * 0.25;
@@ -152,4 +163,49 @@ void UEffectShape::SetupMesh()
 void UEffectShape::UpdateDecalVectors()
 {
 	;
+}
+
+void UEffectShape::OnMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (bIsEnabled && bDecalUpdatesEnabled)
+		UpdateDecalVectors();
+	else if (bIsEnabled)
+		bDecalDirty = true;
+}
+
+void UEffectShape::SetDecalUpdatesEnabled(bool bEnabled)
+{
+	if (bDecalUpdatesEnabled == bEnabled)
+		return;
+
+	bDecalUpdatesEnabled = bEnabled;
+	if (bDecalUpdatesEnabled && bDecalDirty && bIsEnabled)
+		UpdateDecalVectors();
+	bDecalDirty = false;
+}
+
+void UEffectShape::SetDecalScalar(FName Name, float Value)
+{
+	if (!DecalDynamicMat)
+		return;
+
+	float* LastValue = DecalScalarValues.Find(Name);
+	if (LastValue && FMath::IsNearlyEqual(*LastValue, Value))
+		return;
+
+	DecalScalarValues.Add(Name, Value);
+	DecalDynamicMat->SetScalarParameterValue(Name, Value);
+}
+
+void UEffectShape::SetDecalVector(FName Name, const FLinearColor& Value)
+{
+	if (!DecalDynamicMat)
+		return;
+
+	FLinearColor* LastValue = DecalVectorValues.Find(Name);
+	if (LastValue && LastValue->Equals(Value))
+		return;
+
+	DecalVectorValues.Add(Name, Value);
+	DecalDynamicMat->SetVectorParameterValue(Name, Value);
 }
\ No newline at end of file
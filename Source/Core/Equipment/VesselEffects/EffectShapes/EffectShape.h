@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/DecalComponent.h"
 #include "Components/SceneComponent.h"
+#include "Curves/CurveFloat.h"
 #include "EffectShape.generated.h"
 
 
@@ -69,26 +70,54 @@ public:
 	UPROPERTY()
 	float MaxMeshScale;
 
+	/// Optional curve mapping swap progress (0 to 1) to scale progress (0 to 1). The swap is linear when this is null.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UCurveFloat* SwapCurve;
+
+	/// Shows the shape and turns its collision on. The shape only ticks while it has a swap to animate.
 	virtual void Enable();
 
 	virtual void Disable();
 
 	void StartSwap(bool bStartGrowing = false);
 
+	/// Turned off for insignificant shapes, the decal catches up with the shape when turned back on.
+	void SetDecalUpdatesEnabled(bool bEnabled);
+
 protected:
 
 	UPROPERTY()
 	bool bBegunPlay = false;
 
-	void Terminate();
+	UPROPERTY()
+	bool bIsEnabled = false;
+
+	bool bDecalUpdatesEnabled = true;
+
+	/// Set when the shape moved while decal updates were off.
+	bool bDecalDirty = false;
+
+	/// Last values pushed to DecalDynamicMat, used to skip parameters that haven't changed.
+	TMap<FName, float> DecalScalarValues;
+	TMap<FName, FLinearColor> DecalVectorValues;
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	virtual void SetupMesh();
 
+	/// Pushes the shape's location and size to the decal material. Called whenever the mesh's transform changes rather than every frame.
 	virtual void UpdateDecalVectors();
 
+	/// Bound to the mesh's TransformUpdated event so the decal follows the shape without ticking.
+	void OnMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/// Sets a decal material parameter only if it differs from the last value set.
+	void SetDecalScalar(FName Name, float Value);
+	void SetDecalVector(FName Name, const FLinearColor& Value);
+
 	friend class UPassiveVesselEffect;
 };
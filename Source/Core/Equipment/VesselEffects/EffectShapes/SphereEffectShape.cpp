@@ -5,14 +5,7 @@
 
 USphereEffectShape::USphereEffectShape()
 {
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> EffectShapeMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Effects/Meshes/SM_EffectsSphere.SM_EffectsSphere'"));
-	if (EffectShapeMeshFinder.Object)
-	{
-		EffectShapeMesh->SetStaticMesh(EffectShapeMeshFinder.Object);
-		EffectShapeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		EffectShapeMesh->SetUsingAbsoluteRotation(true);
-		EffectShapeMesh->SetupAttachment(this);
-	}
+	EffectShapeMesh->SetUsingAbsoluteRotation(true);
 }
 
 void USphereEffectShape::SetupMesh()
@@ -32,8 +25,8 @@ void USphereEffectShape::UpdateDecalVectors()
 {
 	if (EffectShapeMesh && DecalDynamicMat)
 	{
-		DecalDynamicMat->SetScalarParameterValue("Radius", EffectShapeMesh->Bounds.SphereRadius);
-		DecalDynamicMat->SetVectorParameterValue("Start", EffectShapeMesh->GetComponentLocation());
-		DecalDynamicMat->SetVectorParameterValue("End", EffectShapeMesh->GetComponentLocation());
+		SetDecalScalar("Radius", EffectShapeMesh->Bounds.SphereRadius);
+		SetDecalVector("Start", EffectShapeMesh->GetComponentLocation());
+		SetDecalVector("End", EffectShapeMesh->GetComponentLocation());
 	}
 }
@@ -4,6 +4,9 @@
 #include "CyanVesselEffect.h"
 #include "../VesselTargets/GroupTargets/CyanGroupTarget.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Cyan Effect Tick"), STAT_CyanVesselEffectTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UCyanVesselEffect::UCyanVesselEffect()
@@ -16,12 +19,8 @@ UCyanVesselEffect::UCyanVesselEffect()
 
 	ForceDirection = CreateDefaultSubobject<UCyanDirection>(TEXT("ForceDirection"));
 
-	static ConstructorHelpers::FObjectFinder<UMaterialInstance> GlowMatFinder(TEXT("MaterialInstanceConstant'/Game/Speegypt/Effects/Materials/MAT_CyanGlow_Inst.MAT_CyanGlow_Inst'"));
-	if (GlowMatFinder.Object)
-	{
-		GlowMat = GlowMatFinder.Object;
-		DecalColor = CYAN_BASE_COLOR;
-	}
+	// The glow material and decal colour are looked up in the UVesselColorRegistry in OnRegister
+	ColorState = EVesselState::Cyan;
 }
 
 
@@ -39,6 +38,8 @@ void UCyanVesselEffect::BeginPlay()
 // Called every frame
 void UCyanVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_CyanVesselEffectTick, CyanVesselEffect);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	//SCREENMSG("CYAN");
 	ForceDirection->CalculateForceDirection();
@@ -49,25 +50,20 @@ void UCyanVesselEffect::ApplyEffect(UPassiveVesselTarget* Target, UStaticMeshCom
 	if (Target && TargetComponent)
 	{
 		UCyanVesselTarget* PureTarget = Cast<UCyanVesselTarget>(Target);
-		UTargetData* Data = Target->GetDataOfComponent(TargetComponent);
-		if (PureTarget && Data)
+		if (PureTarget)
 		{
-			UCyanTargetData* Component = Cast<UCyanTargetData>(Data);
+			FCyanComponentData* Component = PureTarget->GetDataOfComponentAs<FCyanComponentData>(TargetComponent);
 			if (Component)
 			{
-				UPrimitiveComponent* Primitive = PureTarget->GetComponentByName(Component->ComponentName);
-				if (Primitive)
-				{
-					PureTarget->AddSource(TargetComponent);
-
-					Primitive->SetEnableGravity(false);
-					Primitive->SetPhysicsLinearVelocity(FVector(Primitive->GetPhysicsLinearVelocity().X, Primitive->GetPhysicsLinearVelocity().Y, 0));
-					Component->bApplyForce = true;
-					ForceDirection->CalculateForceDirection();
-					Component->ForceDirections.Add(ForceDirection);
-					Component->ForceMagnitude += ForceMagnitude;
-					Component->UpdateComponentDirection();
-				}
+				PureTarget->AddSource(TargetComponent);
+
+				TargetComponent->SetEnableGravity(false);
+				TargetComponent->SetPhysicsLinearVelocity(FVector(TargetComponent->GetPhysicsLinearVelocity().X, TargetComponent->GetPhysicsLinearVelocity().Y, 0));
+				Component->bApplyForce = true;
+				ForceDirection->CalculateForceDirection();
+				Component->ForceDirections.Add(ForceDirection);
+				Component->ForceMagnitude += ForceMagnitude;
+				Component->UpdateComponentDirection();
 			}
 		}
 	}
@@ -78,38 +74,33 @@ void UCyanVesselEffect::RemoveEffect(UPassiveVesselTarget* Target, UStaticMeshCo
 	if (Target && TargetComponent)
 	{
 		UCyanVesselTarget* PureTarget = Cast<UCyanVesselTarget>(Target);
-		UTargetData* Data = Target->GetDataOfComponent(TargetComponent);
-		if (PureTarget && Data)
+		if (PureTarget)
 		{
-			UCyanTargetData* Component = Cast<UCyanTargetData>(Data);
+			FCyanComponentData* Component = PureTarget->GetDataOfComponentAs<FCyanComponentData>(TargetComponent);
 			if (Component)
 			{
-				UPrimitiveComponent* Primitive = PureTarget->GetComponentByName(Component->ComponentName);
-				if (Primitive)
-				{
-					int SourceCheck = PureTarget->RemoveSource(TargetComponent);
+				int SourceCheck = PureTarget->RemoveSource(TargetComponent);
 
-					Component->ForceDirections.Remove(ForceDirection);
-					Component->ForceMagnitude -= ForceMagnitude;
-					Component->UpdateComponentDirection();
+				Component->ForceDirections.Remove(ForceDirection);
+				Component->ForceMagnitude -= ForceMagnitude;
+				Component->UpdateComponentDirection();
 
-					if (SourceCheck == 2)
-					{
-						Primitive->SetEnableGravity(true);
-						Component->bApplyForce = false;
-					}
+				if (SourceCheck == 2)
+				{
+					TargetComponent->SetEnableGravity(true);
+					Component->bApplyForce = false;
 				}
 			}
 		}
 	}
 }
 
-void UCyanVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UCyanVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
-	if (Target && Data)
+	if (Target && TargetComponent)
 	{
 		UCyanGroupTarget* PureTarget = Cast<UCyanGroupTarget>(Target);
-		UCyanTargetData* PureData = Cast<UCyanTargetData>(Data);
+		FCyanComponentData* PureData = PureTarget ? PureTarget->GetDataOfComponentAs<FCyanComponentData>(TargetComponent) : nullptr;
 		if (PureTarget && PureData)
 		{
 			PureTarget->AddSource(PureData);
@@ -119,9 +110,8 @@ void UCyanVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTarget
 			PureData->ForceMagnitude += ForceMagnitude;
 			PureData->UpdateComponentDirection();
 
-			for (auto& Name : PureData->GroupMembers)
+			for (auto& Primitive : PureData->GroupMemberComponents)
 			{
-				UPrimitiveComponent* Primitive = PureTarget->GetComponentByName(Name);
 				if (Primitive)
 				{
 					Primitive->SetEnableGravity(false);
@@ -132,12 +122,12 @@ void UCyanVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTarget
 	}
 }
 
-void UCyanVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UCyanVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
-	if (Target && Data)
+	if (Target && TargetComponent)
 	{
 		UCyanGroupTarget* PureTarget = Cast<UCyanGroupTarget>(Target);
-		UCyanTargetData* PureData = Cast<UCyanTargetData>(Data);
+		FCyanComponentData* PureData = PureTarget ? PureTarget->GetDataOfComponentAs<FCyanComponentData>(TargetComponent) : nullptr;
 
 		if (PureTarget && PureData)
 		{
@@ -151,9 +141,8 @@ void UCyanVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTar
 			{
 				PureData->bApplyForce = false;
 
-				for (auto& Name : PureData->GroupMembers)
+				for (auto& Primitive : PureData->GroupMemberComponents)
 				{
-					UPrimitiveComponent* Primitive = PureTarget->GetComponentByName(Name);
 					if (Primitive)
 					{
 						Primitive->SetEnableGravity(true);
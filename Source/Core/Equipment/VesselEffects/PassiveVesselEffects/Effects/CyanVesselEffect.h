@@ -23,9 +23,9 @@ public:
 
 	virtual void RemoveEffect(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
-	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data) override;
+	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
-	virtual	void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data) override;
+	virtual	void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float ForceMagnitude = 0.0f;
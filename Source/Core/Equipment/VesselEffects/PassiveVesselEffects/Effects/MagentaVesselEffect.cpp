@@ -3,6 +3,9 @@
 
 #include "MagentaVesselEffect.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Magenta Effect Tick"), STAT_MagentaVesselEffectTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UMagentaVesselEffect::UMagentaVesselEffect()
@@ -13,12 +16,8 @@ UMagentaVesselEffect::UMagentaVesselEffect()
 
 	CollisionProfileName = "MagentaVessel";
 
-	static ConstructorHelpers::FObjectFinder<UMaterialInstance> GlowMatFinder(TEXT("MaterialInstanceConstant'/Game/Speegypt/Effects/Materials/MAT_MagentaGlow_Inst.MAT_MagentaGlow_Inst'"));
-	if (GlowMatFinder.Object)
-	{
-		GlowMat = GlowMatFinder.Object;
-		DecalColor = MAGENTA_BASE_COLOR;
-	}
+	// The glow material and decal colour are looked up in the UVesselColorRegistry in OnRegister
+	ColorState = EVesselState::Magenta;
 }
 
 
@@ -33,6 +32,8 @@ void UMagentaVesselEffect::BeginPlay()
 // Called every frame
 void UMagentaVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_MagentaVesselEffectTick, MagentaVesselEffect);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	//SCREENMSG("MAGENTA");
@@ -43,26 +44,14 @@ void UMagentaVesselEffect::ApplyEffect(UPassiveVesselTarget* Target, UStaticMesh
 	UMagentaVesselTarget* PureTarget = Cast<UMagentaVesselTarget>(Target);
 	if (PureTarget)
 	{
-		UMagentaTargetData* Component = Cast<UMagentaTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
-		if (Component)
-		{
-			PureTarget->AddSource(TargetComponent);
-			Component->bIsFixed = true;
-			PureTarget->SetDataOfComponent(Component);
-		}
+		// The target fixes the component and powers anything linked to it
+		PureTarget->AddSource(TargetComponent);
 	}
 }
 
 void UMagentaVesselEffect::RemoveEffect(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
 	UMagentaVesselTarget* PureTarget = Cast<UMagentaVesselTarget>(Target);
-	if (PureTarget && PureTarget->RemoveSource(TargetComponent) == 2)
-	{
-		UMagentaTargetData* Component = Cast<UMagentaTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
-		if (Component)
-		{
-			Component->bIsFixed = false;
-			PureTarget->SetDataOfComponent(Component);
-		}
-	}
+	if (PureTarget)
+		PureTarget->RemoveSource(TargetComponent);
 }
@@ -3,6 +3,12 @@
 
 #include "PassiveVesselEffect.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../VesselSignificanceSubsystem.h"
+#include "../../../VesselColorRegistry.h"
+#include "../../../../HelperFiles/VesselStats.h"
+#include "GameFramework/Pawn.h"
+
+DECLARE_CYCLE_STAT(TEXT("Passive Effect Tick"), STAT_PassiveVesselEffectTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UPassiveVesselEffect::UPassiveVesselEffect()
@@ -12,7 +18,9 @@ UPassiveVesselEffect::UPassiveVesselEffect()
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.TickGroup = TG_PostPhysics;
 
+	// Every shape is created and registered up front and kept disabled until it is the active one, so switching shapes never creates components.
 	EffectShape = CreateDefaultSubobject<UEffectShape>(TEXT("EffectShape"));
+	DefaultEffectShape = EffectShape;
 	BoxEffectShape = CreateDefaultSubobject<UBoxEffectShape>(TEXT("BoxEffectShape"));
 	CapsuleEffectShape = CreateDefaultSubobject<UCapsuleEffectShape>(TEXT("CapsuleEffectShape"));
 	ConeEffectShape = CreateDefaultSubobject<UConeEffectShape>(TEXT("ConeEffectShape"));
@@ -30,17 +38,86 @@ void UPassiveVesselEffect::PostLoad()
 	Super::PostLoad();
 }
 
+void UPassiveVesselEffect::OnRegister()
+{
+	Super::OnRegister();
+
+	// The registry loads its assets on first use, so it is only read here and never from the constructors
+	const UVesselColorRegistry* Registry = UVesselColorRegistry::Get();
+	const FVesselColorAssets& Color = Registry->GetColor(ColorState);
+	GlowMat = Color.GlowMaterial;
+	DecalColor = FVector(Color.LightColor);
+
+	const EEffectShapeType MeshTypes[] = { EEffectShapeType::Box, EEffectShapeType::Cone, EEffectShapeType::Sphere };
+	for (auto& Type : MeshTypes)
+	{
+		UEffectShape* Shape = GetPooledShape(Type);
+		UStaticMesh* Mesh = Registry->GetShapeMesh(Type);
+		if (Shape && Mesh)
+			Shape->EffectShapeMesh->SetStaticMesh(Mesh);
+	}
+	// The default shape is a plain sphere until SetEffectShapeType is first called
+	if (DefaultEffectShape && Registry->GetShapeMesh(EEffectShapeType::Sphere))
+		DefaultEffectShape->EffectShapeMesh->SetStaticMesh(Registry->GetShapeMesh(EEffectShapeType::Sphere));
+	if (CapsuleEffectShape)
+		CapsuleEffectShape->SetMeshType(CapsuleEffectShape->MeshType);
+
+	TArray<UEffectShape*> Shapes;
+	GetPooledShapes(Shapes);
+	for (auto& Shape : Shapes)
+	{
+		Shape->EffectShapeMesh->SetCollisionProfileName(FName(CollisionProfileName));
+		Shape->GlowMat = GlowMat;
+		Shape->DecalMat = Registry->GetDecalMaterial();
+		Shape->DecalColor = DecalColor;
+		if (GlowMat)
+			Shape->EffectShapeMesh->SetMaterial(0, GlowMat);
+
+		// Setting the profile turns collision back on, so the inactive shapes are disabled again.
+		if (Shape != EffectShape)
+			Shape->Disable();
+	}
+}
+
 // Called when the game starts
 void UPassiveVesselEffect::BeginPlay()
 {
 	Super::BeginPlay();
 
-	EffectShape->EffectShapeMesh->OnComponentEndOverlap.AddDynamic(this, &UPassiveVesselEffect::OnOverlapEnd);
+	// Bound on every pooled shape, disabling collision on a shape that is swapped out ends its overlaps through here.
+	TArray<UEffectShape*> Shapes;
+	GetPooledShapes(Shapes);
+	for (auto& Shape : Shapes)
+		Shape->EffectShapeMesh->OnComponentEndOverlap.AddDynamic(this, &UPassiveVesselEffect::OnOverlapEnd);
+
+	// The player's own effects are left alone. The rest keep their tick rate, it applies their forces, only the decals are throttled.
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance && !Cast<APawn>(GetOwner()))
+		Significance->Register(this, 1, false);
+}
+
+void UPassiveVesselEffect::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance)
+		Significance->Unregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPassiveVesselEffect::SetDecalUpdatesEnabled(bool bEnabled)
+{
+	TArray<UEffectShape*> Shapes;
+	GetPooledShapes(Shapes);
+	for (auto& Shape : Shapes)
+		Shape->SetDecalUpdatesEnabled(bEnabled);
 }
 
 // Called every frame, affects unaffected yellow objects
 void UPassiveVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_PassiveVesselEffectTick, PassiveVesselEffect);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	TArray<UPrimitiveComponent*> NewTargets;
@@ -69,7 +146,7 @@ void UPassiveVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, F
 						//SCREENMSG("ADD");
 						//SCREENMSG(NewTarget->GetName()); 
 						if (OtherPureTarget)
-							ApplyEffectToGroup(OtherPureTarget, OtherPureTarget->GetDataOfComponent(NewTarget));
+							ApplyEffectToGroup(OtherPureTarget, NewTarget);
 						else
 							ApplyEffect(PureTarget, NewTarget);
 					}
@@ -104,7 +181,7 @@ void UPassiveVesselEffect::OnOverlapEnd(class UPrimitiveComponent* OverlappedCom
 						//SCREENMSG("REMOVE");
 						//SCREENMSG(TargetData->Actor->GetName());
 						if(OtherPureTarget)
-							RemoveEffectFromGroup(OtherPureTarget, OtherPureTarget->GetDataOfComponent(PureOtherComp));
+							RemoveEffectFromGroup(OtherPureTarget, PureOtherComp);
 						else
 							RemoveEffect(PureTarget, PureOtherComp);
 					}
@@ -118,6 +195,7 @@ void UPassiveVesselEffect::OnOverlapEnd(class UPrimitiveComponent* OverlappedCom
 void UPassiveVesselEffect::Enable()
 {
 	Super::Enable();
+	bIsActive = true;
 	EffectShape->Enable();
 }
 
@@ -125,6 +203,7 @@ void UPassiveVesselEffect::Enable()
 void UPassiveVesselEffect::Disable()
 {
 	Super::Disable();
+	bIsActive = false;
 	EffectShape->Disable();
 }
 
@@ -140,54 +219,65 @@ void UPassiveVesselEffect::RemoveEffect(UPassiveVesselTarget* Target, UStaticMes
 	;
 }
 
-void UPassiveVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UPassiveVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
 	;
 }
 
-void UPassiveVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UPassiveVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
 	;
 }
 
 void UPassiveVesselEffect::SetEffectShapeType(EEffectShapeType NewType)
 {
-	if (BoxEffectShape && CapsuleEffectShape && ConeEffectShape && OrbEffectShape)
+	UEffectShape* NewShape = GetPooledShape(NewType);
+	if (!NewShape)
+		return;
+
+	EffectShapeType = NewType;
+	if (NewShape == EffectShape)
+		return;
+
+	NewShape->EffectShapeMesh->SetCollisionProfileName(FName(CollisionProfileName));
+	NewShape->GlowMat = GlowMat;
+	NewShape->DecalColor = DecalColor;
+	NewShape->EffectSwapState = EffectShape->EffectSwapState;
+	NewShape->SwapTimer = EffectShape->SwapTimer;
+
+	EffectShape->EffectSwapState = EEffectSwapState::Idle;
+	EffectShape->Disable();
+
+	EffectShape = NewShape;
+	if (bIsActive)
+		EffectShape->Enable();
+	else
+		EffectShape->Disable();
+}
+
+UEffectShape* UPassiveVesselEffect::GetPooledShape(EEffectShapeType Type) const
+{
+	switch (Type)
 	{
-		EffectShapeType = NewType;
-		EffectShape->Decal->DestroyComponent();
-		EffectShape->EffectShapeMesh->DestroyComponent();
-		EffectShape->DestroyComponent();
+	case EEffectShapeType::Box:
+		return BoxEffectShape;
+	case EEffectShapeType::Capsule:
+		return CapsuleEffectShape;
+	case EEffectShapeType::Cone:
+		return ConeEffectShape;
+	case EEffectShapeType::Sphere:
+		return OrbEffectShape;
+	default:
+		return nullptr;
+	}
+}
 
-		switch (EffectShapeType)
-		{
-		case EEffectShapeType::Box:
-			EffectShape = BoxEffectShape;
-			CapsuleEffectShape->Terminate();
-			ConeEffectShape->Terminate();
-			OrbEffectShape->Terminate();
-			break;
-		case EEffectShapeType::Capsule:
-			EffectShape = CapsuleEffectShape;
-			BoxEffectShape->Terminate();
-			ConeEffectShape->Terminate();
-			OrbEffectShape->Terminate();
-			break;
-		case EEffectShapeType::Cone:
-			EffectShape = ConeEffectShape;
-			CapsuleEffectShape->Terminate();
-			BoxEffectShape->Terminate();
-			OrbEffectShape->Terminate();
-			break;
-		case EEffectShapeType::Sphere:
-			EffectShape = OrbEffectShape;
-			CapsuleEffectShape->Terminate();
-			BoxEffectShape->Terminate();
-			ConeEffectShape->Terminate();
-			break;
-		}
-		EffectShape->EffectShapeMesh->SetCollisionProfileName(FName(CollisionProfileName));
-		EffectShape->GlowMat = GlowMat;
-		EffectShape->DecalColor = DecalColor;
+void UPassiveVesselEffect::GetPooledShapes(TArray<UEffectShape*>& OutShapes) const
+{
+	UEffectShape* Shapes[] = { DefaultEffectShape, BoxEffectShape, CapsuleEffectShape, ConeEffectShape, OrbEffectShape };
+	for (auto& Shape : Shapes)
+	{
+		if (Shape)
+			OutShapes.Add(Shape);
 	}
 }
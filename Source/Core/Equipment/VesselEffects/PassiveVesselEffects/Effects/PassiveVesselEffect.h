@@ -18,10 +18,6 @@
 #define MAGENTA_CHANNEL  ECC_GameTraceChannel4
 #define YELLOW_CHANNEL   ECC_GameTraceChannel5
 
-#define CYAN_BASE_COLOR FVector(0.265, 0.56, 0.847)
-#define MAGENTA_BASE_COLOR FVector(0.906, 0.261, 0.947)
-#define YELLOW_BASE_COLOR FVector(0.875, 0.93, 0.237)
-
 
 UCLASS(ABSTRACT)
 class SPEEGYPT_API UPassiveVesselEffect : public UVesselEffects
@@ -49,8 +45,21 @@ public:
 
 	FString CollisionProfileName = "Default";
 
+	/// Colour this effect looks up in the UVesselColorRegistry when it registers, sets GlowMat and DecalColor.
+	EVesselState ColorState = EVesselState::Empty;
+
+	/// Fills OutShapes with every shape in this effect's pool, including the inactive ones.
+	void GetPooledShapes(TArray<UEffectShape*>& OutShapes) const;
+
+	/// Called by the UVesselSignificanceSubsystem, stops the shapes updating their decals while the effect is insignificant.
+	void SetDecalUpdatesEnabled(bool bEnabled);
+
 private:
 
+	/// Shape used until SetEffectShapeType is first called.
+	UPROPERTY()
+	UEffectShape* DefaultEffectShape;
+
 	UPROPERTY()
 	UBoxEffectShape* BoxEffectShape;
 
@@ -63,13 +72,21 @@ private:
 	UPROPERTY()
 	USphereEffectShape* OrbEffectShape;
 
+	/// Set between Enable and Disable. Tick state can't stand in for it, the idle sleep changes it too.
+	bool bIsActive = false;
+
 protected:
 
 	virtual void PostLoad() override;
 
+	/// Applies the UVesselColorRegistry's colours and meshes, then pushes the effect's collision profile and colours to every pooled shape before any of them begin play.
+	virtual void OnRegister() override;
+
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UFUNCTION(BlueprintCallable)
 	virtual void ApplyEffect(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent);
 
@@ -77,13 +94,17 @@ protected:
 	virtual	void RemoveEffect(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent);
 
 	UFUNCTION(BlueprintCallable)
-	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data);
+	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent);
 
 	UFUNCTION(BlueprintCallable)
-	virtual	void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data);
+	virtual	void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent);
 
+	/// Swaps the active shape for the pooled shape of the given type. The pooled shapes are all registered up front, so this only disables one and enables the other.
 	void SetEffectShapeType(EEffectShapeType NewType);
 
+	/// Returns the pooled shape used for the given type.
+	UEffectShape* GetPooledShape(EEffectShapeType Type) const;
+
 public:	
 
 	// Called every frame
@@ -4,6 +4,9 @@
 #include "YellowVesselEffect.h"
 #include "../../ActiveVesselEffects/Misc/RockPillar.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Yellow Effect Tick"), STAT_YellowVesselEffectTick, STATGROUP_VesselEffects);
 
 
 // Sets default values for this component's properties
@@ -15,12 +18,8 @@ UYellowVesselEffect::UYellowVesselEffect()
 
 	CollisionProfileName = "YellowVessel";
 
-	static ConstructorHelpers::FObjectFinder<UMaterialInstance> GlowMatFinder(TEXT("MaterialInstanceConstant'/Game/Speegypt/Effects/Materials/MAT_YellowGlow_Inst.MAT_YellowGlow_Inst'"));
-	if (GlowMatFinder.Object)
-	{
-		GlowMat = GlowMatFinder.Object;
-		DecalColor = YELLOW_BASE_COLOR;
-	}
+	// The glow material and decal colour are looked up in the UVesselColorRegistry in OnRegister
+	ColorState = EVesselState::Yellow;
 }
 
 // Called when the game starts
@@ -33,6 +32,8 @@ void UYellowVesselEffect::BeginPlay()
 // Called every frame
 void UYellowVesselEffect::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_YellowVesselEffectTick, YellowVesselEffect);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	//SCREENMSG("YELLOW");
@@ -47,7 +48,7 @@ void UYellowVesselEffect::ApplyEffect(UPassiveVesselTarget* Target, UStaticMeshC
 		if (PureTarget)
 		{
 			PureTarget->AddSource(TargetComponent);
-			UYellowTargetData* PureComponent = Cast<UYellowTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
+			FYellowComponentData* PureComponent = PureTarget->GetDataOfComponentAs<FYellowComponentData>(TargetComponent);
 			if (PureComponent)
 			{
 				TargetComponent->SetCollisionProfileName(PureComponent->AffectedCollisionProfileName);
@@ -76,7 +77,7 @@ void UYellowVesselEffect::RemoveEffect(UPassiveVesselTarget* Target, UStaticMesh
 		UYellowVesselTarget* PureTarget = Cast<UYellowVesselTarget>(Target);
 		if (PureTarget && PureTarget->RemoveSource(TargetComponent) == 2)
 		{
-			UYellowTargetData* Component = Cast<UYellowTargetData>(PureTarget->GetDataOfComponent(TargetComponent));
+			FYellowComponentData* Component = PureTarget->GetDataOfComponentAs<FYellowComponentData>(TargetComponent);
 			if (Component)
 			{
 				TargetComponent->SetCollisionProfileName(Component->UnaffectedCollisionProfileName);
@@ -97,21 +98,20 @@ void UYellowVesselEffect::RemoveEffect(UPassiveVesselTarget* Target, UStaticMesh
 	}
 }
 
-void UYellowVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UYellowVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
 	//SCREENMSG("APPLY YELLOW EFFECT");
 
-	if (Target && Data)
+	if (Target && TargetComponent)
 	{
 		UYellowGroupTarget* PureTarget = Cast<UYellowGroupTarget>(Target);
-		UYellowTargetData* PureData = Cast<UYellowTargetData>(Data);
+		FYellowComponentData* PureData = PureTarget ? PureTarget->GetDataOfComponentAs<FYellowComponentData>(TargetComponent) : nullptr;
 		if (PureTarget && PureData)
 		{
 			PureTarget->AddSource(PureData);
 
-			for (auto& Name : PureData->GroupMembers)
+			for (auto& TargetComponent : PureData->GroupMemberComponents)
 			{
-				UPrimitiveComponent* TargetComponent = PureTarget->GetComponentByName(Name);
 				if (TargetComponent)
 				{
 					TargetComponent->SetCollisionProfileName(PureData->AffectedCollisionProfileName);
@@ -133,31 +133,33 @@ void UYellowVesselEffect::ApplyEffectToGroup(UPassiveVesselTarget* Target, UTarg
 	}
 }
 
-void UYellowVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data)
+void UYellowVesselEffect::RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent)
 {
 	//SCREENMSG("REMOVE YELLOW EFFECT");
 
-	if (Target && Data)
+	if (Target && TargetComponent)
 	{
 		UYellowGroupTarget* PureTarget = Cast<UYellowGroupTarget>(Target);
-		UYellowTargetData* PureData = Cast<UYellowTargetData>(Data);
+		FYellowComponentData* PureData = PureTarget ? PureTarget->GetDataOfComponentAs<FYellowComponentData>(TargetComponent) : nullptr;
 		if (PureTarget && PureData && PureTarget->RemoveSource(PureData) == 2)
 		{
-			for (auto& Name : PureData->GroupMembers)
+			for (auto& TargetComponent : PureData->GroupMemberComponents)
 			{
-				UPrimitiveComponent* TargetComponent = PureTarget->GetComponentByName(Name);
-				TargetComponent->SetCollisionProfileName(PureData->UnaffectedCollisionProfileName);
-				TargetComponent->SetSimulatePhysics(PureData->bIsUnaffectedPhysicsSimulated);
-				TargetComponent->SetVisibility(PureData->bIsAffectedHidden, true);
-
-				if (PureData->bIsAffectedHidden)
+				if (TargetComponent)
 				{
-					TargetComponent->SetCollisionResponseToChannel(CYAN_CHANNEL, PureData->CyanResponse);
-					TargetComponent->SetCollisionResponseToChannel(MAGENTA_CHANNEL, PureData->MagentaResponse);
-					TargetComponent->SetCollisionResponseToChannel(LIME_CHANNEL, PureData->LimeResponse);
-					TargetComponent->SetCollisionResponseToChannel(ORANGE_CHANNEL, PureData->OrangeResponse);
-					TargetComponent->SetCollisionResponseToChannel(VIOLET_CHANNEL, PureData->VioletResponse);
-					TargetComponent->SetCollisionResponseToChannel(INTERACT_CHANNEL, PureData->InteractResponse);
+					TargetComponent->SetCollisionProfileName(PureData->UnaffectedCollisionProfileName);
+					TargetComponent->SetSimulatePhysics(PureData->bIsUnaffectedPhysicsSimulated);
+					TargetComponent->SetVisibility(PureData->bIsAffectedHidden, true);
+
+					if (PureData->bIsAffectedHidden)
+					{
+						TargetComponent->SetCollisionResponseToChannel(CYAN_CHANNEL, PureData->CyanResponse);
+						TargetComponent->SetCollisionResponseToChannel(MAGENTA_CHANNEL, PureData->MagentaResponse);
+						TargetComponent->SetCollisionResponseToChannel(LIME_CHANNEL, PureData->LimeResponse);
+						TargetComponent->SetCollisionResponseToChannel(ORANGE_CHANNEL, PureData->OrangeResponse);
+						TargetComponent->SetCollisionResponseToChannel(VIOLET_CHANNEL, PureData->VioletResponse);
+						TargetComponent->SetCollisionResponseToChannel(INTERACT_CHANNEL, PureData->InteractResponse);
+					}
 				}
 			}
 		}
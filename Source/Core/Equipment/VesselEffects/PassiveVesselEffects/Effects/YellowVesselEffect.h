@@ -26,9 +26,9 @@ public:
 
 	virtual void RemoveEffect(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
-	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UTargetData* Data) override;
+	virtual void ApplyEffectToGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
-	virtual void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UTargetData* Data) override;
+	virtual void RemoveEffectFromGroup(UPassiveVesselTarget* Target, UStaticMeshComponent* TargetComponent) override;
 
 public:	
 	// Called every frame
@@ -0,0 +1,165 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MagentaPowerSubsystem.h"
+#include "Engine/World.h"
+#include "../VesselTargets/MagentaVesselTarget.h"
+
+UMagentaPowerSubsystem* UMagentaPowerSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UMagentaPowerSubsystem>() : nullptr;
+}
+
+void UMagentaPowerSubsystem::RegisterTarget(UMagentaVesselTarget* Target)
+{
+	if (!Target || !Target->GetOwner())
+		return;
+
+	ActorTargets.Add(Target->GetOwner(), Target);
+	for (auto& Actor : Target->PoweredActors)
+	{
+		if (Actor && Actor != Target->GetOwner())
+			Inputs.AddUnique(Actor, Target);
+	}
+
+	// A target relinked while powered has to push its power down the new links
+	if (Target->bIsPowered && (Target->HasDirectPower() || HasPoweredInput(Target)))
+		PropagateGain(Target);
+	else
+		UpdatePower(Target);
+}
+
+void UMagentaPowerSubsystem::UnregisterTarget(UMagentaVesselTarget* Target)
+{
+	if (!Target || !Target->GetOwner())
+		return;
+
+	TArray<UMagentaVesselTarget*> Outputs;
+	GetOutputs(Target, Outputs);
+
+	ActorTargets.Remove(Target->GetOwner());
+	for (auto& Actor : Target->PoweredActors)
+		Inputs.RemoveSingle(Actor, Target);
+
+	for (auto& Output : Outputs)
+		UpdatePower(Output);
+}
+
+void UMagentaPowerSubsystem::UpdatePower(UMagentaVesselTarget* Target)
+{
+	if (!Target)
+		return;
+
+	bool bShouldBePowered = Target->HasDirectPower() || HasPoweredInput(Target);
+	if (bShouldBePowered && !Target->bIsPowered)
+		PropagateGain(Target);
+	else if (Target->bIsPowered && !Target->HasDirectPower())
+		PropagateLoss(Target);
+	else
+		Target->ApplyPower(Target->bIsPowered, HasPoweredInput(Target));
+}
+
+void UMagentaPowerSubsystem::Deinitialize()
+{
+	ActorTargets.Empty();
+	Inputs.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMagentaPowerSubsystem::GetOutputs(const UMagentaVesselTarget* Target, TArray<UMagentaVesselTarget*>& OutOutputs) const
+{
+	for (auto& Actor : Target->PoweredActors)
+	{
+		UMagentaVesselTarget* const* Output = ActorTargets.Find(Actor);
+		if (Output && *Output && *Output != Target)
+			OutOutputs.AddUnique(*Output);
+	}
+}
+
+bool UMagentaPowerSubsystem::HasPoweredInput(const UMagentaVesselTarget* Target, const TSet<UMagentaVesselTarget*>* Excluded) const
+{
+	TArray<UMagentaVesselTarget*> TargetInputs;
+	Inputs.MultiFind(Target->GetOwner(), TargetInputs);
+	for (auto& Input : TargetInputs)
+	{
+		if (Input && Input->bIsPowered && (!Excluded || !Excluded->Contains(Input)))
+			return true;
+	}
+	return false;
+}
+
+void UMagentaPowerSubsystem::PropagateGain(UMagentaVesselTarget* Target)
+{
+	TArray<UMagentaVesselTarget*> Queue;
+	Target->ApplyPower(true, HasPoweredInput(Target));
+	Queue.Add(Target);
+
+	for (int i = 0; i < Queue.Num(); i++)
+	{
+		TArray<UMagentaVesselTarget*> Outputs;
+		GetOutputs(Queue[i], Outputs);
+		for (auto& Output : Outputs)
+		{
+			if (!Output->bIsPowered)
+				Queue.Add(Output);
+			Output->ApplyPower(true, true);
+		}
+	}
+}
+
+void UMagentaPowerSubsystem::PropagateLoss(UMagentaVesselTarget* Target)
+{
+	// Every powered target downstream of the one that lost power
+	TSet<UMagentaVesselTarget*> Affected;
+	TArray<UMagentaVesselTarget*> Queue;
+	Affected.Add(Target);
+	Queue.Add(Target);
+	for (int i = 0; i < Queue.Num(); i++)
+	{
+		TArray<UMagentaVesselTarget*> Outputs;
+		GetOutputs(Queue[i], Outputs);
+		for (auto& Output : Outputs)
+		{
+			if (Output->bIsPowered && !Affected.Contains(Output))
+			{
+				Affected.Add(Output);
+				Queue.Add(Output);
+			}
+		}
+	}
+
+	// Targets in the subgraph that still have power of their own or from outside of it
+	TSet<UMagentaVesselTarget*> Powered;
+	Queue.Reset();
+	for (auto& AffectedTarget : Affected)
+	{
+		if (AffectedTarget->HasDirectPower() || HasPoweredInput(AffectedTarget, &Affected))
+		{
+			Powered.Add(AffectedTarget);
+			Queue.Add(AffectedTarget);
+		}
+	}
+	for (int i = 0; i < Queue.Num(); i++)
+	{
+		TArray<UMagentaVesselTarget*> Outputs;
+		GetOutputs(Queue[i], Outputs);
+		for (auto& Output : Outputs)
+		{
+			if (Affected.Contains(Output) && !Powered.Contains(Output))
+			{
+				Powered.Add(Output);
+				Queue.Add(Output);
+			}
+		}
+	}
+
+	// Switch off what lost power first so the input checks below see the final state
+	for (auto& AffectedTarget : Affected)
+	{
+		if (!Powered.Contains(AffectedTarget))
+			AffectedTarget->ApplyPower(false, false);
+	}
+	for (auto& AffectedTarget : Powered)
+		AffectedTarget->ApplyPower(true, HasPoweredInput(AffectedTarget));
+}
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MagentaPowerSubsystem.generated.h"
+
+class UMagentaVesselTarget;
+
+/// Graph of Magenta targets that power each other. A target is powered while a Magenta effect is on it, or while any target
+/// linked to it through PoweredActors is powered. Changes are propagated only through the part of the graph downstream of them.
+UCLASS()
+class SPEEGYPT_API UMagentaPowerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// Returns the subsystem of the given world, or nullptr if there isn't one.
+	static UMagentaPowerSubsystem* Get(const UWorld* World);
+
+	/// Adds the target and its links to the graph, and powers it if anything feeding it already is.
+	void RegisterTarget(UMagentaVesselTarget* Target);
+
+	/// Removes the target from the graph, anything only it was powering loses power.
+	void UnregisterTarget(UMagentaVesselTarget* Target);
+
+	/// Called when the target gains or loses a direct Magenta source, propagates the change to everything downstream.
+	void UpdatePower(UMagentaVesselTarget* Target);
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	/// Registered target of each actor.
+	UPROPERTY()
+	TMap<AActor*, UMagentaVesselTarget*> ActorTargets;
+
+	/// Targets feeding each actor, from their PoweredActors.
+	TMultiMap<AActor*, UMagentaVesselTarget*> Inputs;
+
+	/// Registered targets the given target powers.
+	void GetOutputs(const UMagentaVesselTarget* Target, TArray<UMagentaVesselTarget*>& OutOutputs) const;
+
+	/// Returns true if any registered target feeding the given one is powered, ignoring the targets in Excluded.
+	bool HasPoweredInput(const UMagentaVesselTarget* Target, const TSet<UMagentaVesselTarget*>* Excluded = nullptr) const;
+
+	/// Powers the target and everything downstream of it that isn't powered yet.
+	void PropagateGain(UMagentaVesselTarget* Target);
+
+	/// Unpowers the target and everything downstream of it, then powers back whatever is still fed from outside or directly.
+	/// Only the downstream subgraph is visited, which also handles loops keeping themselves powered.
+	void PropagateLoss(UMagentaVesselTarget* Target);
+};
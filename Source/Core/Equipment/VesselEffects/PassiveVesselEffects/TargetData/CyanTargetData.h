@@ -38,3 +38,33 @@ public:
 		CurrentDirection = DirectionSum;
 	};
 };
+
+USTRUCT(BlueprintType)
+struct FCyanComponentData : public FPassiveComponentData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bApplyForce = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite)
+	float ForceMagnitude = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector CurrentDirection = FVector::ZeroVector;
+
+	/// Directions of the Cyan effects currently on the component.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	TSet<UCyanDirection*> ForceDirections;
+
+	FORCEINLINE void UpdateComponentDirection()
+	{
+		FVector DirectionSum = FVector(0, 0, 0);
+		for (auto& Vector : ForceDirections)
+		{
+			DirectionSum += Vector->Direction;
+		}
+		DirectionSum.Normalize();
+		CurrentDirection = DirectionSum;
+	};
+};
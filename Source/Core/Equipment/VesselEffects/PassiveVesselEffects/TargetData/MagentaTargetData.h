@@ -18,3 +18,12 @@ public:
 	bool bIsFixed = false;
 		
 };
+
+USTRUCT(BlueprintType)
+struct FMagentaComponentData : public FPassiveComponentData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bIsFixed = false;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "../../TargetData.h"
 #include "PassiveTargetData.generated.h"
 
@@ -19,4 +20,23 @@ public:
 
 	UPROPERTY(VisibleAnywhere)
 	TArray<FString> GroupMembers;
-};
\ No newline at end of file
+
+	UPROPERTY(VisibleAnywhere, Transient)
+	TArray<UPrimitiveComponent*> GroupMemberComponents;
+};
+
+USTRUCT(BlueprintType)
+struct FPassiveComponentData : public FTargetComponentData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient)
+	int NumSources = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	TArray<FString> GroupMembers;
+
+	/// GroupMembers resolved into the owner's components by UGroupVesselTarget::ResolveGroupMembers, so effects never have to look members up by name.
+	UPROPERTY(VisibleAnywhere, Transient)
+	TArray<UPrimitiveComponent*> GroupMemberComponents;
+};
@@ -3,17 +3,22 @@
 
 #include "CyanVesselTarget.h"
 #include "../../../../HelperFiles/DefinedDebugHelpers.h"
+#include "../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Cyan Target Tick"), STAT_CyanVesselTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UCyanVesselTarget::UCyanVesselTarget()
 {
+	// Ticks to apply the forces of the cyan effects affecting it
+	PrimaryComponentTick.bCanEverTick = true;
+
 	Init();
 }
 
 void UCyanVesselTarget::Init()
 {
-	DataEntryPrefix = "CyanData_";
-	DataType = UCyanTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UCyanVesselTarget, CyanData);
 	CollisionChannel = CYAN_CHANNEL;
 
 	Super::Init();
@@ -29,29 +34,23 @@ void UCyanVesselTarget::BeginPlay()
 // Called every frame
 void UCyanVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_CyanVesselTargetTick, CyanVesselTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 		
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Data : CyanData)
 	{
-		if (Component)
+		if (Data.Component && Data.bApplyForce && Data.bIsAffectedByThisEffect)
 		{
-			UCyanTargetData* PureComponent = Cast<UCyanTargetData>(Component);
-			if (PureComponent && PureComponent->bApplyForce && PureComponent->bIsAffectedByThisEffect)
+			Data.UpdateComponentDirection();
+			for (auto& Direction : Data.ForceDirections)
 			{
-				PureComponent->UpdateComponentDirection();
-				UPrimitiveComponent* Primitive = GetComponentByName(PureComponent->ComponentName);
-				if (Primitive)
-				{
-					for (auto& Direction : PureComponent->ForceDirections)
-					{
-					//	FVector ApexPoint = Direction->SourcePosition + (Direction->SourceHalfHeight * Direction->Direction);
-					//	FVector ApexToObject = Primitive->GetComponentLocation() - ApexPoint;
-					//	FVector ApexToSource = Direction->SourcePosition - ApexPoint;
-					//	float ObjectDotSource = FVector::DotProduct(ApexToObject, ApexToSource);
-					//	if (ObjectDotSource >= 0)
-							Primitive->AddForce(Direction->SourceMagnitude * Direction->Direction);
-					}
-				}
+			//	FVector ApexPoint = Direction->SourcePosition + (Direction->SourceHalfHeight * Direction->Direction);
+			//	FVector ApexToObject = Data.Component->GetComponentLocation() - ApexPoint;
+			//	FVector ApexToSource = Direction->SourcePosition - ApexPoint;
+			//	float ObjectDotSource = FVector::DotProduct(ApexToObject, ApexToSource);
+			//	if (ObjectDotSource >= 0)
+					Data.Component->AddForce(Direction->SourceMagnitude * Direction->Direction);
 			}
 		}
 	}
@@ -21,6 +21,10 @@ public:
 
 	void Init() override;
 
+	/// Settings and applied forces of each of the owner's components.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FCyanComponentData> CyanData;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -3,6 +3,9 @@
 
 #include "CyanGroupTarget.h"
 #include "../../TargetData/CyanTargetData.h"
+#include "../../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Cyan Group Target Tick"), STAT_CyanGroupTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UCyanGroupTarget::UCyanGroupTarget()
@@ -16,8 +19,7 @@ UCyanGroupTarget::UCyanGroupTarget()
 
 void UCyanGroupTarget::Init()
 {
-	DataEntryPrefix = "CyanGroupData_";
-	DataType = UCyanTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UCyanGroupTarget, CyanData);
 	CollisionChannel = CYAN_CHANNEL;
 
 	Initialize();
@@ -37,30 +39,27 @@ void UCyanGroupTarget::BeginPlay()
 // Called every frame
 void UCyanGroupTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_CyanGroupTargetTick, CyanGroupTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Data : CyanData)
 	{
-		if (Component)
+		if (Data.bApplyForce && Data.bIsAffectedByThisEffect)
 		{
-			UCyanTargetData* PureComponent = Cast<UCyanTargetData>(Component);
-			if (PureComponent && PureComponent->bApplyForce && PureComponent->bIsAffectedByThisEffect)
+			Data.UpdateComponentDirection();
+			for (auto& Primitive : Data.GroupMemberComponents)
 			{
-				PureComponent->UpdateComponentDirection();
-				for (auto& Name : PureComponent->GroupMembers)
+				if (Primitive)
 				{
-					UPrimitiveComponent* Primitive = GetComponentByName(Name);
-					if (Primitive)
+					for (auto& Direction : Data.ForceDirections)
 					{
-						for (auto& Direction : PureComponent->ForceDirections)
-						{
-							//FVector ApexPoint = Direction->SourcePosition + (Direction->SourceHalfHeight * Direction->Direction);
-							//FVector ApexToObject = Primitive->GetComponentLocation() - ApexPoint;
-							//FVector ApexToSource = Direction->SourcePosition - ApexPoint;
-							//float ObjectDotSource = FVector::DotProduct(ApexToObject, ApexToSource);
-							//if (ObjectDotSource >= 0)
-								Primitive->AddForce(Direction->SourceMagnitude * Direction->Direction);
-						}
+						//FVector ApexPoint = Direction->SourcePosition + (Direction->SourceHalfHeight * Direction->Direction);
+						//FVector ApexToObject = Primitive->GetComponentLocation() - ApexPoint;
+						//FVector ApexToSource = Direction->SourcePosition - ApexPoint;
+						//float ObjectDotSource = FVector::DotProduct(ApexToObject, ApexToSource);
+						//if (ObjectDotSource >= 0)
+							Primitive->AddForce(Direction->SourceMagnitude * Direction->Direction);
 					}
 				}
 			}
@@ -2,25 +2,22 @@
 
 
 #include "GroupVesselTarget.h"
+#include "../../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Group Target Tick"), STAT_GroupVesselTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UGroupVesselTarget::UGroupVesselTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	// ...
 }
 
 void UGroupVesselTarget::Initialize()
 {
-	if (GetWorld() && DataType)
+	if (GetWorld() && GetComponentDataStruct())
 	{
-		UPassiveTargetData* SceneComponentData = NewObject<UPassiveTargetData>();
-
 		Owner = GetOwner();
-		if (Owner && PrimitiveComponents.Num() <= 0)
+		if (Owner && GetNumComponentData() <= 0)
 		{
 			TArray<USceneComponent*> SceneComponentFinder;
 			TArray<USceneComponent*> GroupMemberFinder;
@@ -30,13 +27,11 @@ void UGroupVesselTarget::Initialize()
 			{
 				if (Component && Component->GetName().Contains("Group"))
 				{
-					FString NewEntryName = DataEntryPrefix;
-					NewEntryName.Append(Component->GetName());
-					SceneComponentData = NewObject<UPassiveTargetData>(this, DataType, FName(*NewEntryName));
+					FPassiveComponentData* SceneComponentData = GetComponentDataAs<FPassiveComponentData>(AddComponentData(Component->GetName()));
+					if (!SceneComponentData)
+						continue;
 
-					SceneComponentData->RegisterComponent();
 					SceneComponentData->bIsAffectedByThisEffect = true;
-					SceneComponentData->ComponentName = Component->GetName();
 
 					GroupMemberFinder = Component->GetAttachChildren();
 
@@ -52,78 +47,111 @@ void UGroupVesselTarget::Initialize()
 							}
 						}
 					}
-					PrimitiveComponents.Add(SceneComponentData);
 				}
 			}
 		}
+
+		// ResolveComponentData resolves the members itself
+		if (HasBegunPlay())
+			ResolveComponentData();
+		else
+			ResolveGroupMembers();
 	}
 }
 
-// Called when the game starts
-void UGroupVesselTarget::BeginPlay()
+void UGroupVesselTarget::ResolveGroupMembers()
 {
-	Super::BeginPlay();
+	if (!Owner)
+		return;
+
+	TArray<UPrimitiveComponent*> PrimitiveComponentFinder;
+	Owner->GetComponents<UPrimitiveComponent>(PrimitiveComponentFinder);
+
+	TMap<FString, UPrimitiveComponent*> ComponentsByName;
+	for (auto& Component : PrimitiveComponentFinder)
+	{
+		if (Component)
+			ComponentsByName.Add(Component->GetName(), Component);
+	}
 
-	if (Owner)
+	for (int32 Index = 0; Index < GetNumComponentData(); Index++)
 	{
-		for (auto& Component : PrimitiveComponents)
+		FPassiveComponentData* Data = GetComponentDataAs<FPassiveComponentData>(Index);
+		if (Data)
 		{
-			if (Component)
+			Data->GroupMemberComponents.Reset(Data->GroupMembers.Num());
+			for (auto& Name : Data->GroupMembers)
 			{
-				UPassiveTargetData* Data = Cast<UPassiveTargetData>(Component);
-				if (Data)
-				{
-					for (auto& Name : Data->GroupMembers)
-					{
-						UPrimitiveComponent* Primitive = GetComponentByName(Name);
-						if (Primitive)
-						{
-							if (Component->bIsAffectedByThisEffect)
-								Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Overlap);
-							else
-								Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Ignore);
-						}
-					}
-				}
+				UPrimitiveComponent* Member = ComponentsByName.FindRef(Name);
+				if (Member)
+					Data->GroupMemberComponents.Add(Member);
 			}
 		}
 	}
 }
 
+// Called when the game starts
+void UGroupVesselTarget::BeginPlay()
+{
+	// the members' collision responses are set up by UVesselTarget::BeginPlay from the indices added in ResolveComponentData
+	Super::BeginPlay();
+}
 
 // Called every frame
 void UGroupVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_GroupVesselTargetTick, GroupVesselTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 }
 
-UTargetData* UGroupVesselTarget::GetDataOfComponent(UPrimitiveComponent* Component)
+FTargetComponentData* UGroupVesselTarget::GetDataOfComponent(UPrimitiveComponent* Component)
 {
+	if (bIsDataResolved)
+		return Super::GetDataOfComponent(Component);
+
 	if (Owner && Component && Component->GetOwner() && Owner == Component->GetOwner())
 	{
-		for (auto& Entry : PrimitiveComponents)
+		for (int32 Index = 0; Index < GetNumComponentData(); Index++)
 		{
-			if (Entry)
+			FPassiveComponentData* PureEntry = GetComponentDataAs<FPassiveComponentData>(Index);
+			if (PureEntry && PureEntry->GroupMemberComponents.Contains(Component))
 			{
-				UPassiveTargetData* PureEntry = Cast<UPassiveTargetData>(Entry);
-				if (PureEntry && PureEntry->GroupMembers.Contains(Component->GetName()))
-				{
-					return Entry;
-				}
+				return PureEntry;
 			}
 		}
 	}
 	return nullptr;
 }
 
-UTargetData* UGroupVesselTarget::GetDataOfSceneComponent(USceneComponent* Component)
+void UGroupVesselTarget::ResolveComponentData()
+{
+	ComponentIndices.Reset();
+	DataGeneration++;
+	bIsDataResolved = true;
+
+	ResolveGroupMembers();
+
+	for (int32 Index = 0; Index < GetNumComponentData(); Index++)
+	{
+		FPassiveComponentData* Data = GetComponentDataAs<FPassiveComponentData>(Index);
+		if (Data)
+		{
+			for (auto& Member : Data->GroupMemberComponents)
+				AddComponentIndex(Member, Index);
+		}
+	}
+}
+
+FTargetComponentData* UGroupVesselTarget::GetDataOfSceneComponent(USceneComponent* Component)
 {
 	if (Owner && Component && Component->GetOwner() && Owner == Component->GetOwner())
 	{
-		for (auto& Entry : PrimitiveComponents)
+		for (int32 Index = 0; Index < GetNumComponentData(); Index++)
 		{
-			if (Entry && Entry->ComponentName == Component->GetName())
+			FTargetComponentData* Entry = GetComponentDataAt(Index);
+			if (Entry->ComponentName == Component->GetName())
 			{
 				return Entry;
 			}
@@ -148,95 +176,67 @@ USceneComponent* UGroupVesselTarget::GetSceneComponentByName(FString Name)
 #if WITH_EDITOR
 void UGroupVesselTarget::RefreshComponentData()
 {
-	if (Owner)
+	if (!Owner || GetNumComponentData() == 0)
 	{
-		TArray<USceneComponent*> SceneComponentFinder;
-		Owner->GetComponents<USceneComponent>(SceneComponentFinder);
+		Init();
+		return;
+	}
 
-		int MyNum = PrimitiveComponents.Num();
+	TArray<USceneComponent*> SceneComponentFinder;
+	Owner->GetComponents<USceneComponent>(SceneComponentFinder);
 
-		if (MyNum == 0)
+	TMap<FString, USceneComponent*> SceneComponents;
+	TSet<FString> MeshNames;
+	for (auto& Component : SceneComponentFinder)
+	{
+		if (Component && !Component->IsPendingKillOrUnreachable())
 		{
-			Init();
-			return;
+			SceneComponents.Add(Component->GetName(), Component);
+			if (Cast<UStaticMeshComponent>(Component))
+				MeshNames.Add(Component->GetName());
 		}
+	}
 
-		int TheirNum = SceneComponentFinder.Num();
-
-		// looking for group headers to add
-		for (int m = 0; m < TheirNum; m++)
-		{
-			for (int n = 0; n < MyNum; n++)
-			{
-				USceneComponent* SceneComponent = GetSceneComponentByName(SceneComponentFinder[m]->GetName());
-				if (SceneComponent && SceneComponent->GetName().Contains("Group") && !GetDataOfSceneComponent(SceneComponent))
-				{
-					FString NewEntryName = DataEntryPrefix;
-					NewEntryName.Append(SceneComponent->GetName());
-
-					UPassiveTargetData* PrimitiveComponentData = NewObject<UPassiveTargetData>(this, DataType, *NewEntryName);
-					PrimitiveComponentData->RegisterComponent();
+	// looking for groups to remove
+	RemoveComponentData([&](FTargetComponentData& Data)
+	{
+		return !SceneComponents.Contains(Data.ComponentName);
+	});
 
-					PrimitiveComponentData->ComponentName = SceneComponent->GetName();
-					PrimitiveComponents.Add(PrimitiveComponentData);
-				}
-			}
-		}
-		
-		//looking for group members to add
-		TArray<UStaticMeshComponent*> StaticMeshComponentFinder;
-		Owner->GetComponents<UStaticMeshComponent>(StaticMeshComponentFinder);
-		for (auto& Component : StaticMeshComponentFinder)
-		{
-			if (Component && !GetDataOfComponent(Component) && Component->GetAttachParent())
-			{
-				UTargetData* GroupData = GetDataOfSceneComponent(Component->GetAttachParent());
-				if (GroupData)
-				{
-					UPassiveTargetData* PureGroupData = Cast<UPassiveTargetData>(GroupData);
-					if (PureGroupData)
-					{
-						PureGroupData->GroupMembers.Add(Component->GetName());
-					}
-				}
-			}
-		}
-		
-		// looking for groups to remove 
-		TArray<UTargetData*> NewComponents = PrimitiveComponents;
-		for (auto& Component : PrimitiveComponents)
+	// looking for members to remove, everything left over is already in a group. Groups are kept by index, adding one can reallocate the data
+	TMap<FString, int32> Groups;
+	TSet<FString> GroupedMembers;
+	for (int32 Index = 0; Index < GetNumComponentData(); Index++)
+	{
+		FPassiveComponentData* PureComponent = GetComponentDataAs<FPassiveComponentData>(Index);
+		if (PureComponent)
 		{
-			if (Component)
-			{
-				USceneComponent* SceneComponent = GetSceneComponentByName(Component->ComponentName);
-				if (!SceneComponent || SceneComponent->IsPendingKillOrUnreachable())
-				{
-					NewComponents.Remove(Component);
-				}
-			}
-			else
-				NewComponents.Remove(Component);
+			PureComponent->GroupMembers.RemoveAll([&](const FString& Name) { return !MeshNames.Contains(Name); });
+			GroupedMembers.Append(PureComponent->GroupMembers);
+			Groups.Add(PureComponent->ComponentName, Index);
 		}
-		PrimitiveComponents = NewComponents;
+	}
 
-		// looking for members to remove
-		for (auto& Component : PrimitiveComponents)
+	// looking for group headers to add
+	for (auto& SceneComponent : SceneComponents)
+	{
+		if (SceneComponent.Key.Contains("Group") && !Groups.Contains(SceneComponent.Key))
+			Groups.Add(SceneComponent.Key, AddComponentData(SceneComponent.Key));
+	}
+
+	//looking for group members to add
+	for (auto& Name : MeshNames)
+	{
+		USceneComponent* Parent = SceneComponents[Name]->GetAttachParent();
+		if (!GroupedMembers.Contains(Name) && Parent)
 		{
-			if (Component)
-			{
-				UPassiveTargetData* PureComponent = Cast<UPassiveTargetData>(Component);
-				if (PureComponent)
-				{
-					for (auto i = PureComponent->GroupMembers.CreateIterator(); i; i++)
-					{
-						if (!GetComponentByName(*i))
-						{
-							i.RemoveCurrent();
-						}
-					}
-				}
-			}
+			const int32* GroupIndex = Groups.Find(Parent->GetName());
+			FPassiveComponentData* GroupData = GroupIndex ? GetComponentDataAs<FPassiveComponentData>(*GroupIndex) : nullptr;
+			if (GroupData)
+				GroupData->GroupMembers.Add(Name);
 		}
 	}
+
+	ResolveGroupMembers();
 }
 #endif
\ No newline at end of file
@@ -19,6 +19,9 @@ public:
 
 	void Initialize();
 
+	/// Fills GroupMemberComponents on every group from its GroupMembers names. Called at BeginPlay and whenever the groups are refreshed in the editor.
+	void ResolveGroupMembers();
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -27,9 +30,12 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-	UTargetData* GetDataOfComponent(UPrimitiveComponent* Component) override;
+	FTargetComponentData* GetDataOfComponent(UPrimitiveComponent* Component) override;
+
+	/// Maps every group member to the data of its group.
+	void ResolveComponentData() override;
 
-	UTargetData* GetDataOfSceneComponent(USceneComponent* Component);
+	FTargetComponentData* GetDataOfSceneComponent(USceneComponent* Component);
 
 	USceneComponent* GetSceneComponentByName(FString Name);
 
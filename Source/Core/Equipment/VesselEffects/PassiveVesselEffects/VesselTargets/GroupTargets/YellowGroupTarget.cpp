@@ -8,21 +8,19 @@
 #include "../../../ActiveVesselEffects/Targets/LimeVesselTarget.h"
 #include "../../../ActiveVesselEffects/Targets/OrangeVesselTarget.h"
 #include "../../../ActiveVesselEffects/Targets/VioletVesselTarget.h"
+#include "../../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Yellow Group Target Tick"), STAT_YellowGroupTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UYellowGroupTarget::UYellowGroupTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
 	Init();
 }
 
 void UYellowGroupTarget::Init()
 {
-	DataEntryPrefix = "YellowGroupData_";
-	DataType = UYellowTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UYellowGroupTarget, YellowData);
 	CollisionChannel = YELLOW_CHANNEL;
 
 	Initialize();
@@ -34,11 +32,11 @@ void UYellowGroupTarget::BeginPlay()
 {
 	Super::BeginPlay();
 
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Data : YellowData)
 	{
-		if (Component && Component->bIsAffectedByThisEffect)
+		if (Data.bIsAffectedByThisEffect)
 		{
-			UYellowTargetData* PureComponentData = Cast<UYellowTargetData>(Component);
+			FYellowComponentData* PureComponentData = &Data;
 			if (PureComponentData)
 			{
 				if (PureComponentData->bIsAffectedHidden)
@@ -64,12 +62,11 @@ void UYellowGroupTarget::BeginPlay()
 				if (Owner)
 				{
 					UVesselTarget* PureTarget;
-					UTargetData* PureTargetData;
+					FTargetComponentData* PureTargetData;
 					TArray<UVesselTarget*> VesselTargetFinder;
 					Owner->GetComponents<UVesselTarget>(VesselTargetFinder);
-					for (auto Name : PureComponentData->GroupMembers)
+					for (auto& NewComponent : PureComponentData->GroupMemberComponents)
 					{
-						UPrimitiveComponent* NewComponent = GetComponentByName(Name);
 						if (NewComponent)
 						{
 							UStaticMeshComponent* PureComponent = Cast<UStaticMeshComponent>(NewComponent);
@@ -81,7 +78,7 @@ void UYellowGroupTarget::BeginPlay()
 									//	PureTarget = Cast<UCyanVesselTarget>(Target);
 									//	if (PureTarget && PureTarget->Owner)
 									//	{
-									//		PureTargetData = Cast<UCyanTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+									//		PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 									//		if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 									//			PureComponentData->CyanResponse = ECR_Overlap;
 									//		continue;
@@ -89,7 +86,7 @@ void UYellowGroupTarget::BeginPlay()
 									//	PureTarget = Cast<UMagentaVesselTarget>(Target);
 									//	if (PureTarget && PureTarget->Owner)
 									//	{
-									//		PureTargetData = Cast<UMagentaTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+									//		PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 									//		if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 									//			PureComponentData->MagentaResponse = ECR_Overlap;
 									//		continue;
@@ -97,7 +94,7 @@ void UYellowGroupTarget::BeginPlay()
 									//	PureTarget = Cast<ULimeVesselTarget>(Target);
 									//	if (PureTarget && PureTarget->Owner)
 									//	{
-									//		PureTargetData = Cast<ULimeTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+									//		PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 									//		if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 									//			PureComponentData->LimeResponse = ECR_Overlap;
 									//		continue;
@@ -105,7 +102,7 @@ void UYellowGroupTarget::BeginPlay()
 									PureTarget = Cast<UOrangeVesselTarget>(Target);
 									if (PureTarget && PureTarget->Owner)
 									{
-										PureTargetData = Cast<UOrangeTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+										PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 										if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 											PureComponentData->OrangeResponse = ECR_Block;
 										//continue;
@@ -113,7 +110,7 @@ void UYellowGroupTarget::BeginPlay()
 									//	PureTarget = Cast<UVioletVesselTarget>(Target);
 									//	if (PureTarget && PureTarget->Owner)
 									//	{
-									//		PureTargetData = Cast<UVioletTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+									//		PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 									//		if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 									//			PureComponentData->VioletResponse = ECR_Block;
 									//		continue;
@@ -167,6 +164,8 @@ void UYellowGroupTarget::BeginPlay()
 // Called every frame
 void UYellowGroupTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_YellowGroupTargetTick, YellowGroupTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// ...
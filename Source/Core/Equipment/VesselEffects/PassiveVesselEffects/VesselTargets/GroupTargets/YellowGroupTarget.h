@@ -19,6 +19,10 @@ public:
 
 	void Init() override;
 
+	/// Settings of each group of the owner's components, and the collision its members switch to while affected or unaffected.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FYellowComponentData> YellowData;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -2,6 +2,7 @@
 
 
 #include "MagentaVesselTarget.h"
+#include "../Misc/MagentaPowerSubsystem.h"
 
 // Sets default values for this component's properties
 UMagentaVesselTarget::UMagentaVesselTarget()
@@ -11,8 +12,7 @@ UMagentaVesselTarget::UMagentaVesselTarget()
 
 void UMagentaVesselTarget::Init()
 {
-	DataEntryPrefix = "MagentaData_";
-	DataType = UMagentaTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UMagentaVesselTarget, MagentaData);
 	CollisionChannel = MAGENTA_CHANNEL;
 
 	Super::Init();
@@ -23,4 +23,70 @@ void UMagentaVesselTarget::BeginPlay()
 {
 	Super::BeginPlay();
 
+	UMagentaPowerSubsystem* Subsystem = UMagentaPowerSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->RegisterTarget(this);
+}
+
+void UMagentaVesselTarget::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UMagentaPowerSubsystem* Subsystem = UMagentaPowerSubsystem::Get(GetWorld());
+	if (Subsystem)
+		Subsystem->UnregisterTarget(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UMagentaVesselTarget::SetPoweredActors(const TArray<AActor*>& Actors)
+{
+	UMagentaPowerSubsystem* Subsystem = HasBegunPlay() ? UMagentaPowerSubsystem::Get(GetWorld()) : nullptr;
+	if (Subsystem)
+		Subsystem->UnregisterTarget(this);
+
+	PoweredActors = Actors;
+
+	if (Subsystem)
+		Subsystem->RegisterTarget(this);
+}
+
+bool UMagentaVesselTarget::AddSource(UPrimitiveComponent* Component)
+{
+	bool bWasAdded = Super::AddSource(Component);
+
+	UMagentaPowerSubsystem* Subsystem = UMagentaPowerSubsystem::Get(GetWorld());
+	if (bWasAdded && Subsystem)
+		Subsystem->UpdatePower(this);
+	return bWasAdded;
+}
+
+int UMagentaVesselTarget::RemoveSource(UPrimitiveComponent* Component)
+{
+	int Result = Super::RemoveSource(Component);
+
+	UMagentaPowerSubsystem* Subsystem = UMagentaPowerSubsystem::Get(GetWorld());
+	if (Result && Subsystem)
+		Subsystem->UpdatePower(this);
+	return Result;
+}
+
+bool UMagentaVesselTarget::HasDirectPower() const
+{
+	for (auto& Data : MagentaData)
+	{
+		if (Data.NumSources > 0)
+			return true;
+	}
+	return false;
+}
+
+void UMagentaVesselTarget::ApplyPower(bool bPowered, bool bPoweredByNetwork)
+{
+	for (auto& Data : MagentaData)
+		Data.bIsFixed = Data.NumSources > 0 || (bPoweredByNetwork && Data.bIsAffectedByThisEffect);
+
+	if (bIsPowered != bPowered)
+	{
+		bIsPowered = bPowered;
+		OnPowerChanged.Broadcast(bIsPowered);
+	}
 }
@@ -8,6 +8,7 @@
 #include "../TargetData/MagentaTargetData.h"
 #include "MagentaVesselTarget.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMagentaPowerDelegate, bool, bIsPowered);
 
 UCLASS( ClassGroup=(Custom), meta = (BlueprintSpawnableComponent))
 class SPEEGYPT_API UMagentaVesselTarget : public UPassiveVesselTarget
@@ -20,8 +21,41 @@ public:
 
 	void Init() override;
 
+	/// Settings of each of the owner's components, and whether it is fixed in place.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FMagentaComponentData> MagentaData;
+
+	/// Actors whose Magenta targets are powered while this target is. Use SetPoweredActors to change it during play.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<AActor*> PoweredActors;
+
+	/// Replaces PoweredActors and relinks the target in the UMagentaPowerSubsystem, so power follows the new links.
+	UFUNCTION(BlueprintCallable)
+	void SetPoweredActors(const TArray<AActor*>& Actors);
+
+	/// True while a Magenta effect is on one of the components, or a target powering this one is powered.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bIsPowered = false;
+
+	/// Broadcast when bIsPowered changes.
+	UPROPERTY(BlueprintAssignable)
+	FMagentaPowerDelegate OnPowerChanged;
+
+	bool AddSource(UPrimitiveComponent* Component) override;
+
+	int RemoveSource(UPrimitiveComponent* Component) override;
+
+	/// Returns true if a Magenta effect is on any of the components.
+	bool HasDirectPower() const;
+
+	/// Called by the UMagentaPowerSubsystem. Components are fixed while they have a source, or all of them while powered by another target.
+	void ApplyPower(bool bPowered, bool bPoweredByNetwork);
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	/// Removes the target from the UMagentaPowerSubsystem.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 };
@@ -5,11 +5,13 @@
 #include "CyanVesselTarget.h"
 #include "MagentaVesselTarget.h"
 #include "YellowVesselTarget.h"
+#include "../../../../HelperFiles/VesselStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Passive Target Tick"), STAT_PassiveVesselTargetTick, STATGROUP_VesselEffects);
 
 // Sets default values for this component's properties
 UPassiveVesselTarget::UPassiveVesselTarget()
 {
-	PrimaryComponentTick.bCanEverTick = true;
 }
 
 // Called when the game starts
@@ -21,38 +23,37 @@ void UPassiveVesselTarget::BeginPlay()
 
 void UPassiveVesselTarget::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	for (auto& Component : PrimitiveComponents)
+	for (int32 Index = 0; Index < GetNumComponentData(); Index++)
 	{
-		if (Component)
-		{
-			UPassiveTargetData* PureComponent = Cast<UPassiveTargetData>(Component);
-			if(PureComponent)
-				PureComponent->NumSources = 0;
-		}
+		FPassiveComponentData* PureComponent = GetComponentDataAs<FPassiveComponentData>(Index);
+		if(PureComponent)
+			PureComponent->NumSources = 0;
 	}
 }
 
 void UPassiveVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	VESSEL_SCOPED_TICK_STATS(STAT_PassiveVesselTargetTick, PassiveVesselTarget);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 }
 
 bool UPassiveVesselTarget::AddSource(UPrimitiveComponent* Component)
 {
-	UPassiveTargetData* NewData = Cast<UPassiveTargetData>(GetDataOfComponent(Component));
+	FPassiveComponentData* NewData = GetDataOfComponentAs<FPassiveComponentData>(Component);
 
 	return AddSource(NewData);
 }
 
 int UPassiveVesselTarget::RemoveSource(UPrimitiveComponent* Component)
 {
-	UPassiveTargetData* NewData = Cast<UPassiveTargetData>(GetDataOfComponent(Component));
+	FPassiveComponentData* NewData = GetDataOfComponentAs<FPassiveComponentData>(Component);
 
 	return RemoveSource(NewData);
 }
 
-bool UPassiveVesselTarget::AddSource(UPassiveTargetData* Data)
+bool UPassiveVesselTarget::AddSource(FPassiveComponentData* Data)
 {
 	if (Data)
 	{
@@ -62,7 +63,7 @@ bool UPassiveVesselTarget::AddSource(UPassiveTargetData* Data)
 	return false;
 }
 
-int UPassiveVesselTarget::RemoveSource(UPassiveTargetData* Data)
+int UPassiveVesselTarget::RemoveSource(FPassiveComponentData* Data)
 {
 	if (Data)
 	{
@@ -26,9 +26,9 @@ public:
 	UFUNCTION()
 	virtual int RemoveSource(UPrimitiveComponent* Component);
 
-	bool AddSource(UPassiveTargetData* Data);
+	bool AddSource(FPassiveComponentData* Data);
 
-	int RemoveSource(UPassiveTargetData* Data);
+	int RemoveSource(FPassiveComponentData* Data);
 
 protected:
 	// Called when the game starts
@@ -15,8 +15,7 @@ UYellowVesselTarget::UYellowVesselTarget()
 
 void UYellowVesselTarget::Init()
 {
-	DataEntryPrefix = "YellowData_";
-	DataType = UYellowTargetData::StaticClass();
+	DataArrayName = GET_MEMBER_NAME_CHECKED(UYellowVesselTarget, YellowData);
 	CollisionChannel = YELLOW_CHANNEL;
 
 	Super::Init();
@@ -26,13 +25,13 @@ void UYellowVesselTarget::Init()
 void UYellowVesselTarget::BeginPlay()
 {
 	Super::BeginPlay();
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Data : YellowData)
 	{
-		if (Component && Component->bIsAffectedByThisEffect)
+		if (Data.Component && Data.bIsAffectedByThisEffect)
 		{
-			UYellowTargetData* PureComponentData = Cast<UYellowTargetData>(Component);
-			UPrimitiveComponent* PureComponent = GetComponentByName(PureComponentData->ComponentName);
-			if (PureComponentData && PureComponentData)
+			FYellowComponentData* PureComponentData = &Data;
+			UPrimitiveComponent* PureComponent = Data.Component;
+			if (PureComponentData)
 			{
 				if (PureComponentData->bIsAffectedHidden)
 				{
@@ -57,7 +56,7 @@ void UYellowVesselTarget::BeginPlay()
 				if (Owner)
 				{
 					UVesselTarget* PureTarget;
-					UTargetData* PureTargetData;
+					FTargetComponentData* PureTargetData;
 					TArray<UVesselTarget*> VesselTargetFinder;
 					Owner->GetComponents<UVesselTarget>(VesselTargetFinder);
 					for (auto& Target : VesselTargetFinder)
@@ -65,7 +64,7 @@ void UYellowVesselTarget::BeginPlay()
 						PureTarget = Cast<UCyanVesselTarget>(Target);
 						if (PureTarget && PureTarget->Owner)
 						{
-							PureTargetData = Cast<UCyanTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+							PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 							if(PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 								PureComponentData->CyanResponse = ECR_Overlap;
 							continue;
@@ -73,7 +72,7 @@ void UYellowVesselTarget::BeginPlay()
 						PureTarget = Cast<UMagentaVesselTarget>(Target);
 						if (PureTarget && PureTarget->Owner)
 						{
-							PureTargetData = Cast<UMagentaTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+							PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 							if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 								PureComponentData->MagentaResponse = ECR_Overlap;
 							continue;
@@ -81,7 +80,7 @@ void UYellowVesselTarget::BeginPlay()
 						PureTarget = Cast<ULimeVesselTarget>(Target);
 						if (PureTarget && PureTarget->Owner)
 						{
-							PureTargetData = Cast<ULimeTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+							PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 							if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 								PureComponentData->LimeResponse = ECR_Overlap;
 							continue;
@@ -89,7 +88,7 @@ void UYellowVesselTarget::BeginPlay()
 						PureTarget = Cast<UOrangeVesselTarget>(Target);
 						if (PureTarget && PureTarget->Owner)
 						{
-							PureTargetData = Cast<UOrangeTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+							PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 							if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 								PureComponentData->OrangeResponse = ECR_Block;
 							continue;
@@ -97,7 +96,7 @@ void UYellowVesselTarget::BeginPlay()
 						PureTarget = Cast<UVioletVesselTarget>(Target);
 						if (PureTarget && PureTarget->Owner)
 						{
-							PureTargetData = Cast<UVioletTargetData>(PureTarget->GetDataOfComponent(PureComponent));
+							PureTargetData = PureTarget->GetDataOfComponent(PureComponent);
 							if (PureTargetData && PureTargetData->bIsAffectedByThisEffect)
 								PureComponentData->VioletResponse = ECR_Block;
 							continue;
@@ -24,6 +24,10 @@ public:
 
 	void Init() override;
 
+	/// Settings of each of the owner's components, and the collision it switches to while affected or unaffected.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize)
+	TArray<FYellowComponentData> YellowData;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
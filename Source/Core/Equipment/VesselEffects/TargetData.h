@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "TargetData.generated.h"
 
 #define LIME_CHANNEL      ECC_GameTraceChannel1
@@ -16,14 +17,30 @@
 #define ORANGE_CHANNEL    ECC_GameTraceChannel8
 #define FIND_SPOT_CHANNEL ECC_GameTraceChannel9
 
-/// Parent class for all TargetData objects. Used to store the name of the component these settings apply to, as well as whether or not that component should be affected by this effect.
-UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+/// Parent class for all TargetData objects. Superseded by FTargetComponentData, only kept so targets saved with one of these objects per
+/// component still load. UVesselTarget::PostLoad copies them into the target's component data.
+UCLASS( ClassGroup=(Custom) )
 class SPEEGYPT_API UTargetData : public UActorComponent
 {
 	GENERATED_BODY()
 
 public:	
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString ComponentName = "";
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bIsAffectedByThisEffect = false;
+
+};
+
+/// Parent struct for the settings a target keeps for each component of its owner. Used to store the name of the component these settings apply to,
+/// as well as whether or not that component should be affected by this effect. Every target stores an array of a struct derived from this one.
+USTRUCT(BlueprintType)
+struct FTargetComponentData
+{
+	GENERATED_BODY()
+
 	/// String containing the name of the associated component. Using a pointer to that component caused problems, and would not work with blueprint actors.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	FString ComponentName = "";
@@ -32,4 +49,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bIsAffectedByThisEffect = false;
 
+	/// ComponentName resolved into the owner's component at BeginPlay, so effects never have to look components up by name. Stays null for group headers.
+	UPROPERTY(Transient, BlueprintReadOnly)
+	UPrimitiveComponent* Component = nullptr;
+};
+
+/// Reference to the data of one of a target's components. Keeps the component as well as its index, so it survives the data being resolved again:
+/// the index is only used while the target's generation still matches, otherwise the component is looked up again.
+USTRUCT(BlueprintType)
+struct FTargetComponentHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Generation = INDEX_NONE;
+
+	bool IsValid() const { return Component.IsValid(); }
 };
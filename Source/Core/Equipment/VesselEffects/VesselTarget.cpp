@@ -2,6 +2,7 @@
 
 
 #include "VesselTarget.h"
+#include "UObject/UnrealType.h"
 #include "PassiveVesselEffects/VesselTargets/PassiveVesselTarget.h"
 #include "PassiveVesselEffects/VesselTargets/CyanVesselTarget.h"
 #include "PassiveVesselEffects/VesselTargets/MagentaVesselTarget.h"
@@ -16,23 +17,16 @@
 // Sets default values for this component's properties
 UVesselTarget::UVesselTarget()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-#if WITH_EDITOR
-	bTickInEditor = true;
-#endif
+	// Only the targets that do work every frame turn their tick on
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UVesselTarget::Init()
 {
-	if (GetWorld() && DataType)
+	if (GetWorld() && GetComponentDataProperty())
 	{
-		UTargetData* PrimitiveComponentData = NewObject<UTargetData>();
-
 		Owner = GetOwner();
-		if (Owner && PrimitiveComponents.Num() <= 0)
+		if (Owner && GetNumComponentData() <= 0)
 		{
 			TArray<UStaticMeshComponent*> PrimitiveComponentFinder;
 			Owner->GetComponents<UStaticMeshComponent>(PrimitiveComponentFinder);
@@ -41,29 +35,57 @@ void UVesselTarget::Init()
 			{
 				if (Component)
 				{
-					FString NewEntryName = DataEntryPrefix;
-					NewEntryName.Append(Component->GetName());
-					PrimitiveComponentData = NewObject<UTargetData>(this, DataType, FName(*NewEntryName));
 					Component->SetGenerateOverlapEvents(true);
 
-					PrimitiveComponentData->RegisterComponent();
+					FTargetComponentData* PrimitiveComponentData = GetComponentDataAt(AddComponentData(Component->GetName()));
 					PrimitiveComponentData->bIsAffectedByThisEffect = true;
-					PrimitiveComponentData->ComponentName = Component->GetName();
-
-					PrimitiveComponents.Add(PrimitiveComponentData);
 				}
 			}
 		}
+
+		if (HasBegunPlay())
+			ResolveComponentData();
 	}
 }
 
 void UVesselTarget::UnInit()
 {
-	PrimitiveComponents.Empty();
+	RemoveComponentData([](FTargetComponentData& Data) { return true; });
+	ComponentIndices.Reset();
+	bIsDataResolved = false;
 	if(Owner)
 		Owner = nullptr;
 }
 
+void UVesselTarget::PostLoad()
+{
+	Super::PostLoad();
+
+	// Saved before the settings were structs, copy every property the old object shares with the struct
+	UScriptStruct* Struct = GetComponentDataStruct();
+	if (Struct && PrimitiveComponents_DEPRECATED.Num() > 0 && GetNumComponentData() == 0)
+	{
+		for (auto& OldData : PrimitiveComponents_DEPRECATED)
+		{
+			if (!OldData)
+				continue;
+
+			OldData->ConditionalPostLoad();
+			FTargetComponentData* NewData = GetComponentDataAt(AddComponentData(OldData->ComponentName));
+			for (TFieldIterator<FProperty> It(Struct); It; ++It)
+			{
+				FProperty* OldProperty = OldData->GetClass()->FindPropertyByName(It->GetFName());
+				if (OldProperty && OldProperty->SameType(*It))
+					It->CopyCompleteValue(It->ContainerPtrToValuePtr<void>(NewData), OldProperty->ContainerPtrToValuePtr<void>(OldData));
+			}
+
+			// nothing references it anymore, keep it out of the next save
+			OldData->SetFlags(RF_Transient);
+		}
+	}
+	PrimitiveComponents_DEPRECATED.Empty();
+}
+
 // Called when the game starts
 void UVesselTarget::BeginPlay()
 {
@@ -71,25 +93,20 @@ void UVesselTarget::BeginPlay()
 
 	if (Owner)
 	{
-		for (auto& Component : PrimitiveComponents)
+		ResolveComponentData();
+
+		for (auto& Entry : ComponentIndices)
 		{
-			if (Component)
+			if (GetComponentDataAt(Entry.Value)->bIsAffectedByThisEffect)
 			{
-				UPrimitiveComponent* Primitive = GetComponentByName(Component->ComponentName);
-				if (Primitive)
-				{
-					if (Component->bIsAffectedByThisEffect)
-					{
-						if (Cast<UPassiveVesselTarget>(this) || Cast<ULimeVesselTarget>(this) || Cast<UVioletTeleportTarget>(this))
-							Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Overlap);
-						if (Cast<UOrangeVesselTarget>(this) || Cast<UVioletVesselTarget>(this))
-							Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Block);
-					}
-					else
-					{
-						Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Ignore);
-					}
-				}
+				if (Cast<UPassiveVesselTarget>(this) || Cast<ULimeVesselTarget>(this) || Cast<UVioletTeleportTarget>(this))
+					Entry.Key->SetCollisionResponseToChannel(CollisionChannel, ECR_Overlap);
+				if (Cast<UOrangeVesselTarget>(this) || Cast<UVioletVesselTarget>(this))
+					Entry.Key->SetCollisionResponseToChannel(CollisionChannel, ECR_Block);
+			}
+			else
+			{
+				Entry.Key->SetCollisionResponseToChannel(CollisionChannel, ECR_Ignore);
 			}
 		}
 	}
@@ -102,91 +119,89 @@ void UVesselTarget::BeginPlay()
 void UVesselTarget::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void UVesselTarget::OnRegister()
+{
+	Super::OnRegister();
 
 #if WITH_EDITOR
-	RefreshComponentData();
+	if (GetWorld() && !GetWorld()->IsGameWorld())
+		RefreshComponentData();
 #endif
 }
 
 void UVesselTarget::OnComponentDestroyed(bool bDestroyingHierarchy)
 {
-	for (auto& Component : PrimitiveComponents)
+	for (auto& Entry : ComponentIndices)
 	{
-		if (Component)
-		{
-			UPrimitiveComponent* Primitive = GetComponentByName(Component->GetName());
-			if (Primitive)
-				Primitive->SetCollisionResponseToChannel(CollisionChannel, ECR_Ignore);
-		}
+		if (Entry.Key)
+			Entry.Key->SetCollisionResponseToChannel(CollisionChannel, ECR_Ignore);
 	}
 }
 
 #if WITH_EDITOR
 void UVesselTarget::RefreshComponentData()
 {
-	if (Owner)
+	if (!Owner || GetNumComponentData() == 0)
 	{
-		TArray<UPrimitiveComponent*> PrimitiveComponentFinder;
-		Owner->GetComponents<UPrimitiveComponent>(PrimitiveComponentFinder);
+		Init();
+		return;
+	}
 
-		int MyNum = PrimitiveComponents.Num();
+	TArray<UPrimitiveComponent*> PrimitiveComponentFinder;
+	Owner->GetComponents<UPrimitiveComponent>(PrimitiveComponentFinder);
 
-		if (MyNum == 0)
-		{
-			Init();
-			return;
-		}
+	TSet<FString> ComponentNames;
+	for (auto& Component : PrimitiveComponentFinder)
+	{
+		if (Component && !Component->IsPendingKillOrUnreachable())
+			ComponentNames.Add(Component->GetName());
+	}
 
-		int TheirNum = PrimitiveComponentFinder.Num();
+	// looking for components to remove, everything left over is already known
+	TSet<FString> KnownNames;
+	RemoveComponentData([&](FTargetComponentData& Data)
+	{
+		if (!ComponentNames.Contains(Data.ComponentName))
+			return true;
 
-		// looking for components to add
-		for (int m = 0; m < TheirNum; m++)
-		{
-			for (int n = 0; n < MyNum; n++)
-			{
-				UPrimitiveComponent* Primitive = GetComponentByName(PrimitiveComponentFinder[m]->GetName());
-				if (Primitive && !GetDataOfComponent(Primitive))
-				{
-					FString NewEntryName = DataEntryPrefix;
-					NewEntryName.Append(Primitive->GetName());
+		KnownNames.Add(Data.ComponentName);
+		return false;
+	});
 
-					UTargetData* PrimitiveComponentData = NewObject<UTargetData>(this, DataType, *NewEntryName);
-					PrimitiveComponentData->RegisterComponent();
+	// looking for components to add
+	for (auto& Name : ComponentNames)
+	{
+		if (!KnownNames.Contains(Name))
+			AddComponentData(Name);
+	}
+}
 
-					PrimitiveComponentData->ComponentName = Primitive->GetName();
-					PrimitiveComponents.Add(PrimitiveComponentData);
-				}
-			}
-		}
+void UVesselTarget::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-		// looking for components to remove 
-		MyNum = PrimitiveComponents.Num();
-		TArray<UTargetData*> NewComponents = PrimitiveComponents;
-		for (auto& Component : PrimitiveComponents)
-		{
-			if (Component)
-			{
-				UPrimitiveComponent* Primitive = GetComponentByName(Component->ComponentName);
-				if (!Primitive || Primitive->IsPendingKillOrUnreachable())
-				{
-					NewComponents.Remove(Component);
-				}
-			}
-			else
-				NewComponents.Remove(Component);
-		}
-		PrimitiveComponents = NewComponents;
-	}
+	RefreshComponentData();
 }
 #endif
 
-UTargetData* UVesselTarget::GetDataOfComponent(UPrimitiveComponent* Component)
+FTargetComponentData* UVesselTarget::GetDataOfComponent(UPrimitiveComponent* Component)
 {
-	for (auto& Entry : PrimitiveComponents)
+	if (bIsDataResolved)
+	{
+		const int32* Index = ComponentIndices.Find(Component);
+		return Index ? GetComponentDataAt(*Index) : nullptr;
+	}
+
+	// the components are only resolved during play, the editor still goes by name
+	if (Owner && Component && Component->GetOwner() == Owner)
 	{
-		if (Owner && Component && Entry && Component->GetOwner() && Owner->GetName() == Component->GetOwner()->GetName() && Entry->ComponentName == Component->GetName())
+		for (int32 Index = 0; Index < GetNumComponentData(); Index++)
 		{
-			return Entry;
+			FTargetComponentData* Data = GetComponentDataAt(Index);
+			if (Data->ComponentName == Component->GetName())
+				return Data;
 		}
 	}
 	return nullptr;
@@ -205,15 +220,139 @@ UPrimitiveComponent* UVesselTarget::GetComponentByName(FString Name)
 	return nullptr;
 }
 
-bool UVesselTarget::SetDataOfComponent(UTargetData* Component)
+FArrayProperty* UVesselTarget::GetComponentDataProperty() const
 {
-	for (auto& Entry : PrimitiveComponents)
+	if (!ComponentDataProperty && !DataArrayName.IsNone())
 	{
-		if (Entry && Component && Entry->ComponentName == Component->ComponentName)
+		FArrayProperty* Property = FindFProperty<FArrayProperty>(GetClass(), DataArrayName);
+		FStructProperty* Inner = Property ? CastField<FStructProperty>(Property->Inner) : nullptr;
+		if (Inner && Inner->Struct->IsChildOf(FTargetComponentData::StaticStruct()))
+			ComponentDataProperty = Property;
+		else
+			UE_LOG(LogTemp, Warning, TEXT("%s is not an array of FTargetComponentData on %s"), *DataArrayName.ToString(), *GetClass()->GetName());
+	}
+	return ComponentDataProperty;
+}
+
+UScriptStruct* UVesselTarget::GetComponentDataStruct() const
+{
+	FArrayProperty* Property = GetComponentDataProperty();
+	return Property ? CastField<FStructProperty>(Property->Inner)->Struct : nullptr;
+}
+
+int32 UVesselTarget::GetNumComponentData() const
+{
+	FArrayProperty* Property = GetComponentDataProperty();
+	if (!Property)
+		return 0;
+
+	FScriptArrayHelper Helper(Property, Property->ContainerPtrToValuePtr<void>(this));
+	return Helper.Num();
+}
+
+FTargetComponentData* UVesselTarget::GetComponentDataAt(int32 Index)
+{
+	FArrayProperty* Property = GetComponentDataProperty();
+	if (!Property)
+		return nullptr;
+
+	// every entry starts with its FTargetComponentData base
+	FScriptArrayHelper Helper(Property, Property->ContainerPtrToValuePtr<void>(this));
+	return Helper.IsValidIndex(Index) ? reinterpret_cast<FTargetComponentData*>(Helper.GetRawPtr(Index)) : nullptr;
+}
+
+int32 UVesselTarget::AddComponentData(const FString& ComponentName)
+{
+	FArrayProperty* Property = GetComponentDataProperty();
+	if (!Property)
+		return INDEX_NONE;
+
+	FScriptArrayHelper Helper(Property, Property->ContainerPtrToValuePtr<void>(this));
+	int32 Index = Helper.AddValue();
+	reinterpret_cast<FTargetComponentData*>(Helper.GetRawPtr(Index))->ComponentName = ComponentName;
+	InvalidateComponentIndices();
+	return Index;
+}
+
+void UVesselTarget::RemoveComponentData(TFunctionRef<bool(FTargetComponentData&)> Predicate)
+{
+	FArrayProperty* Property = GetComponentDataProperty();
+	if (!Property)
+		return;
+
+	FScriptArrayHelper Helper(Property, Property->ContainerPtrToValuePtr<void>(this));
+	for (int32 Index = Helper.Num() - 1; Index >= 0; Index--)
+	{
+		if (Predicate(*reinterpret_cast<FTargetComponentData*>(Helper.GetRawPtr(Index))))
 		{
-			Entry = Component;
-			return true;
+			Helper.RemoveValues(Index);
+			InvalidateComponentIndices();
 		}
 	}
-	return false;
-}
\ No newline at end of file
+}
+
+void UVesselTarget::InvalidateComponentIndices()
+{
+	// the entries may have moved, GetDataOfComponent goes by name until ResolveComponentData runs again
+	ComponentIndices.Reset();
+	DataGeneration++;
+	bIsDataResolved = false;
+}
+
+void UVesselTarget::ResolveComponentData()
+{
+	ComponentIndices.Reset();
+	DataGeneration++;
+	bIsDataResolved = true;
+
+	if (!Owner)
+		return;
+
+	TArray<UStaticMeshComponent*> PrimitiveComponentFinder;
+	Owner->GetComponents<UStaticMeshComponent>(PrimitiveComponentFinder);
+
+	TMap<FString, UPrimitiveComponent*> ComponentsByName;
+	for (auto& Component : PrimitiveComponentFinder)
+	{
+		if (Component)
+			ComponentsByName.Add(Component->GetName(), Component);
+	}
+
+	for (int32 Index = 0; Index < GetNumComponentData(); Index++)
+	{
+		FTargetComponentData* Data = GetComponentDataAt(Index);
+		Data->Component = ComponentsByName.FindRef(Data->ComponentName);
+		AddComponentIndex(Data->Component, Index);
+	}
+}
+
+FTargetComponentHandle UVesselTarget::FindComponent(UPrimitiveComponent* Component) const
+{
+	FTargetComponentHandle Handle;
+	const int32* Index = ComponentIndices.Find(Component);
+	if (Index)
+	{
+		Handle.Component = Component;
+		Handle.Index = *Index;
+		Handle.Generation = DataGeneration;
+	}
+	return Handle;
+}
+
+FTargetComponentData* UVesselTarget::GetData(FTargetComponentHandle& Handle)
+{
+	UPrimitiveComponent* Component = Handle.Component.Get();
+	if (!Component)
+		return nullptr;
+
+	// the entries may have moved since the handle was made
+	if (Handle.Generation != DataGeneration)
+		Handle = FindComponent(Component);
+	return GetComponentDataAt(Handle.Index);
+}
+
+void UVesselTarget::AddComponentIndex(UPrimitiveComponent* Component, int32 Index)
+{
+	if (Component && !ComponentIndices.Contains(Component))
+		ComponentIndices.Add(Component, Index);
+}
@@ -7,6 +7,8 @@
 #include "TargetData.h"
 #include "VesselTarget.generated.h"
 
+class FArrayProperty;
+
 /// Parent class for all VesselTarget components. Used extensively to prepared the components of the owning actor for interaction with all Vessel Effects.
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SPEEGYPT_API UVesselTarget : public UActorComponent
@@ -21,21 +23,15 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	AActor* Owner;
 
+	/// Per component UTargetData objects saved before the settings were stored as structs. Moved into the component data by PostLoad.
 	UPROPERTY()
-	TSubclassOf<UTargetData> DataType;
-
-	UPROPERTY()
-	FString DataEntryPrefix;
-
-	/// Array of target data objects used to determine behaviors of effect interactions on a per component basis.
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	TArray<UTargetData*> PrimitiveComponents;
+	TArray<UTargetData*> PrimitiveComponents_DEPRECATED;
 
 	/// Used to filter which effect gets overlap events from the components set to be affected by this target.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TEnumAsByte<ECollisionChannel> CollisionChannel;
 
-	/// Initialization function. Sets the value of Owner, and initializes the PrimitiveComponents array.
+	/// Initialization function. Sets the value of Owner, and adds an entry to the component data for every static mesh of the owner.
 	UFUNCTION(BlueprintCallable)
 	virtual void Init();
 
@@ -46,30 +42,98 @@ public:
 	UFUNCTION()
 	void OnComponentDestroyed(bool bDestroyingHierarchy); /// marked for delete
 
+	/// Copies PrimitiveComponents_DEPRECATED into the component data, matching the old objects' properties to the struct's by name.
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
-	/// Used to update PrimitiveComponents whenever the owning actor adds or removes a component. Also removes null references in PrimitiveComponents. Components added this way are set to be unaffected by this target.
-	/// For developement only.
+	/// Used to update the component data whenever the owning actor adds or removes a component. Components added this way are set to be unaffected by this target.
+	/// For developement only. Called when this target is registered (which includes construction script reruns and components being added or removed) and when it is edited, rather than every frame.
 	virtual void RefreshComponentData();
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
-	/// Getter for this target's settings related to the given PrimitiveComponent, eturns null if not found
-	UFUNCTION(BlueprintCallable)
-	virtual UTargetData* GetDataOfComponent(UPrimitiveComponent* Component);
+	/// Getter for this target's settings related to the given PrimitiveComponent, returns null if not found
+	virtual FTargetComponentData* GetDataOfComponent(UPrimitiveComponent* Component);
+
+	/// Same as GetDataOfComponent, but also returns null if this target doesn't store T or a struct derived from it.
+	template<typename T>
+	T* GetDataOfComponentAs(UPrimitiveComponent* Component)
+	{
+		UScriptStruct* Struct = GetComponentDataStruct();
+		return Struct && Struct->IsChildOf(T::StaticStruct()) ? static_cast<T*>(GetDataOfComponent(Component)) : nullptr;
+	}
 
-	/// Getter for the PrimitiveComponent of this target's owner of the given name. Used in conjuection with UPassiveTargetData->ComponentName.
+	/// Getter for the PrimitiveComponent of this target's owner of the given name. Used in conjuection with FTargetComponentData::ComponentName.
 	UFUNCTION(BlueprintCallable)
 	UPrimitiveComponent* GetComponentByName(FString Name);
 
-	/// Setter for updating the data of the given TargetData. Returns true if successful.
-	UFUNCTION(BlueprintCallable)
-	bool SetDataOfComponent(UTargetData* Component);
+	/// Number of entries in the component data.
+	int32 GetNumComponentData() const;
+
+	/// Entry of the component data at Index, or null if out of range.
+	FTargetComponentData* GetComponentDataAt(int32 Index);
+
+	/// Same as GetComponentDataAt, but also returns null if this target doesn't store T or a struct derived from it.
+	template<typename T>
+	T* GetComponentDataAs(int32 Index)
+	{
+		UScriptStruct* Struct = GetComponentDataStruct();
+		return Struct && Struct->IsChildOf(T::StaticStruct()) ? static_cast<T*>(GetComponentDataAt(Index)) : nullptr;
+	}
+
+	/// Struct stored in the component data, null if the subclass hasn't set DataArrayName.
+	UScriptStruct* GetComponentDataStruct() const;
+
+	/// Resolves every entry's Component from its ComponentName. Called at BeginPlay and whenever the data is re-initialized during play.
+	virtual void ResolveComponentData();
+
+	/// Returns a handle to the data of the given component, or an invalid handle if it isn't part of this target.
+	FTargetComponentHandle FindComponent(UPrimitiveComponent* Component) const;
+
+	/// Returns the data the handle refers to, or null if its component is gone or no longer part of this target.
+	/// Refreshes the handle if the data was resolved again since it was made.
+	FTargetComponentData* GetData(FTargetComponentHandle& Handle);
 
 protected:
-	/// Called when the game starts, sets up the collision responses for all of the owners components given the data in PrimitiveComponents.
+	/// Name of the subclass's TArray of FTargetComponentData derived structs, set in Init. This class adds, removes and resolves
+	/// the entries through it, the subclasses walk their typed array directly.
+	FName DataArrayName;
+
+	/// Index into the component data of each resolved component. Group members all map to the entry of their group.
+	TMap<UPrimitiveComponent*, int32> ComponentIndices;
+
+	/// Bumped whenever entries are resolved, added or removed, so handles know when their index has to be looked up again.
+	int32 DataGeneration = 0;
+
+	bool bIsDataResolved = false;
+
+	/// Appends an entry for the named component to the component data and returns its index, INDEX_NONE if there is no component data.
+	int32 AddComponentData(const FString& ComponentName);
+
+	/// Removes every entry of the component data the predicate returns true for.
+	void RemoveComponentData(TFunctionRef<bool(FTargetComponentData&)> Predicate);
+
+	/// Maps the component to the entry at Index, unless it is already mapped.
+	void AddComponentIndex(UPrimitiveComponent* Component, int32 Index);
+
+	/// Drops the resolved indices after entries were added or removed, they are rebuilt by the next ResolveComponentData.
+	void InvalidateComponentIndices();
+
+	/// Called when the game starts, sets up the collision responses for all of the owners components given the component data.
 	virtual void BeginPlay() override;
 
+	/// Refreshes the component data when registered in an editor world.
+	virtual void OnRegister() override;
+
+private:
+	/// Array property named by DataArrayName, found on first use.
+	mutable FArrayProperty* ComponentDataProperty = nullptr;
+
+	FArrayProperty* GetComponentDataProperty() const;
+
 public:	
-	/// Calls RefreshComponentData() every frame, but only if running in the editor.
+	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	FORCEINLINE bool operator==(const UVesselTarget& Other) const { return Owner->GetName() == Other.Owner->GetName(); }
@@ -0,0 +1,9 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VesselSignificanceSettings.h"
+
+FName UVesselSignificanceSettings::GetCategoryName() const
+{
+	return TEXT("Game");
+}
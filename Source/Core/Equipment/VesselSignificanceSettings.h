@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "VesselSignificanceSettings.generated.h"
+
+
+/// Tuning of the UVesselSignificanceSubsystem, edited through the project settings. Read by each subsystem when its world starts.
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Vessel Significance"))
+class SPEEGYPT_API UVesselSignificanceSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/// Objects further away than this from the view are never significant.
+	UPROPERTY(Config, EditAnywhere, Category = "Scoring", meta = (ClampMin = "1"))
+	float MaxDistance = 8000;
+
+	/// Significance multiplier for objects that haven't been rendered recently.
+	UPROPERTY(Config, EditAnywhere, Category = "Scoring", meta = (ClampMin = "0", ClampMax = "1"))
+	float HiddenScale = 0.25f;
+
+	/// Objects below this significance are throttled.
+	UPROPERTY(Config, EditAnywhere, Category = "Scoring", meta = (ClampMin = "0", ClampMax = "1"))
+	float SignificanceThreshold = 0.2f;
+
+	/// Tick interval of the least significant objects, the interval scales towards the base one as significance rises.
+	UPROPERTY(Config, EditAnywhere, Category = "Throttling", meta = (ClampMin = "0"))
+	float MaxTickInterval = 1.f;
+
+	/// Number of objects scored each frame.
+	UPROPERTY(Config, EditAnywhere, Category = "Throttling", meta = (ClampMin = "1"))
+	int MaxEvaluationsPerFrame = 32;
+
+	/// Number of objects allowed to run at full rate at once. The highest scoring objects get the slots.
+	UPROPERTY(Config, EditAnywhere, Category = "Throttling", meta = (ClampMin = "0"))
+	int MaxSignificant = 64;
+
+	virtual FName GetCategoryName() const override;
+};
@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VesselSignificanceSubsystem.h"
+#include "VesselSignificanceSettings.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "VesselEffects/PassiveVesselEffects/Effects/PassiveVesselEffect.h"
+
+UVesselSignificanceSubsystem* UVesselSignificanceSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UVesselSignificanceSubsystem>() : nullptr;
+}
+
+void UVesselSignificanceSubsystem::Register(UObject* Object, float Relevance, bool bThrottleTick)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	UActorComponent* Component = Cast<UActorComponent>(Object);
+	if (!Actor && !Component)
+		return;
+
+	for (auto& Entry : Entries)
+	{
+		if (Entry.Object == Object)
+			return;
+	}
+
+	FSignificanceEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Object = Object;
+	Entry.Relevance = Relevance;
+	Entry.bThrottleTick = bThrottleTick;
+	Entry.BaseTickInterval = Actor ? Actor->GetActorTickInterval() : Component->GetComponentTickInterval();
+
+	// Once the cap is full new objects wait to be scored before they can take a slot
+	Entry.bIsSignificant = !bIsEnabled || NumSignificant < MaxSignificant;
+	if (Entry.bIsSignificant)
+		NumSignificant++;
+	else
+	{
+		Entry.Significance = 0;
+		Apply(Entry, GetTickInterval(Entry));
+	}
+}
+
+void UVesselSignificanceSubsystem::Unregister(UObject* Object)
+{
+	for (int i = 0; i < Entries.Num(); i++)
+	{
+		FSignificanceEntry& Entry = Entries[i];
+		if (Entry.Object == Object)
+		{
+			if (Entry.bIsSignificant)
+				NumSignificant--;
+			Entry.bIsSignificant = true;
+			Apply(Entry, Entry.BaseTickInterval);
+
+			Entries.RemoveAtSwap(i);
+			return;
+		}
+	}
+}
+
+void UVesselSignificanceSubsystem::SetEnabled(bool bEnabled)
+{
+	if (bIsEnabled == bEnabled)
+		return;
+
+	bIsEnabled = bEnabled;
+	NumSignificant = 0;
+	for (auto& Entry : Entries)
+	{
+		if (bIsEnabled)
+		{
+			// Nothing holds a slot until it has been scored again
+			Entry.bIsSignificant = false;
+			Entry.Significance = 0;
+		}
+		else
+		{
+			Entry.bIsSignificant = true;
+			NumSignificant++;
+			Apply(Entry, Entry.BaseTickInterval);
+		}
+	}
+}
+
+void UVesselSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UVesselSignificanceSettings* Settings = GetDefault<UVesselSignificanceSettings>();
+	MaxDistance = Settings->MaxDistance;
+	HiddenScale = Settings->HiddenScale;
+	SignificanceThreshold = Settings->SignificanceThreshold;
+	MaxTickInterval = Settings->MaxTickInterval;
+	MaxEvaluationsPerFrame = Settings->MaxEvaluationsPerFrame;
+	MaxSignificant = Settings->MaxSignificant;
+}
+
+void UVesselSignificanceSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	NumSignificant = 0;
+
+	Super::Deinitialize();
+}
+
+void UVesselSignificanceSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	APlayerController* Controller = World ? World->GetFirstPlayerController() : nullptr;
+	if (!Controller)
+		return;
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	int Budget = FMath::Min(MaxEvaluationsPerFrame, Entries.Num());
+	for (int i = 0; i < Budget && Entries.Num() > 0; i++)
+	{
+		if (NextEntry >= Entries.Num())
+			NextEntry = 0;
+
+		FSignificanceEntry& Entry = Entries[NextEntry];
+		if (!Entry.Object.IsValid())
+		{
+			if (Entry.bIsSignificant)
+				NumSignificant--;
+			Entries.RemoveAtSwap(NextEntry);
+			continue;
+		}
+
+		Evaluate(Entry, ViewLocation);
+		NextEntry++;
+	}
+}
+
+bool UVesselSignificanceSubsystem::IsTickable() const
+{
+	return !IsTemplate() && bIsEnabled && Entries.Num() > 0 && GetWorld() && GetWorld()->IsGameWorld();
+}
+
+TStatId UVesselSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVesselSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UVesselSignificanceSubsystem::Evaluate(FSignificanceEntry& Entry, const FVector& ViewLocation)
+{
+	AActor* Actor = Cast<AActor>(Entry.Object.Get());
+	if (!Actor)
+		Actor = Cast<UActorComponent>(Entry.Object.Get())->GetOwner();
+	if (!Actor)
+		return;
+
+	USceneComponent* SceneComponent = Cast<USceneComponent>(Entry.Object.Get());
+	FVector Location = SceneComponent ? SceneComponent->GetComponentLocation() : Actor->GetActorLocation();
+
+	float DistanceScale = 1 - FMath::Clamp(FVector::Dist(Location, ViewLocation) / MaxDistance, 0.f, 1.f);
+	float VisibilityScale = Actor->WasRecentlyRendered(0.5f) ? 1 : HiddenScale;
+	Entry.Significance = Entry.Relevance * DistanceScale * VisibilityScale;
+
+	bool bShouldBeSignificant = Entry.Significance >= SignificanceThreshold;
+	if (bShouldBeSignificant && !Entry.bIsSignificant && NumSignificant >= MaxSignificant)
+	{
+		// The cap is full, take the slot of the lowest scoring significant entry if this one scores higher
+		FSignificanceEntry* Weakest = FindWeakestSignificant();
+		if (Weakest && Weakest->Significance < Entry.Significance)
+		{
+			Weakest->bIsSignificant = false;
+			NumSignificant--;
+			Apply(*Weakest, GetTickInterval(*Weakest));
+		}
+		else
+			bShouldBeSignificant = false;
+	}
+
+	if (bShouldBeSignificant != Entry.bIsSignificant)
+	{
+		Entry.bIsSignificant = bShouldBeSignificant;
+		NumSignificant += bShouldBeSignificant ? 1 : -1;
+	}
+
+	Apply(Entry, GetTickInterval(Entry));
+}
+
+FSignificanceEntry* UVesselSignificanceSubsystem::FindWeakestSignificant()
+{
+	FSignificanceEntry* Weakest = nullptr;
+	for (auto& Entry : Entries)
+	{
+		if (Entry.bIsSignificant && Entry.Object.IsValid() && (!Weakest || Entry.Significance < Weakest->Significance))
+			Weakest = &Entry;
+	}
+	return Weakest;
+}
+
+float UVesselSignificanceSubsystem::GetTickInterval(const FSignificanceEntry& Entry) const
+{
+	if (Entry.bIsSignificant || !Entry.bThrottleTick)
+		return Entry.BaseTickInterval;
+
+	float Alpha = SignificanceThreshold > 0 ? 1 - (Entry.Significance / SignificanceThreshold) : 1;
+	return FMath::Lerp(Entry.BaseTickInterval, FMath::Max(MaxTickInterval, Entry.BaseTickInterval), FMath::Clamp(Alpha, 0.f, 1.f));
+}
+
+void UVesselSignificanceSubsystem::Apply(FSignificanceEntry& Entry, float TickInterval)
+{
+	AActor* Actor = Cast<AActor>(Entry.Object.Get());
+	UActorComponent* Component = Cast<UActorComponent>(Entry.Object.Get());
+
+	if (Actor && !FMath::IsNearlyEqual(Actor->GetActorTickInterval(), TickInterval, 0.01f))
+		Actor->SetActorTickInterval(TickInterval);
+	else if (Component && !FMath::IsNearlyEqual(Component->GetComponentTickInterval(), TickInterval, 0.01f))
+		Component->SetComponentTickInterval(TickInterval);
+
+	UPassiveVesselEffect* PassiveEffect = Cast<UPassiveVesselEffect>(Component);
+	if (PassiveEffect)
+		PassiveEffect->SetDecalUpdatesEnabled(Entry.bIsSignificant);
+}
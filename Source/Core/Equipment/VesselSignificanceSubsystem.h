@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "VesselSignificanceSubsystem.generated.h"
+
+/// An actor or component whose update rate is managed by the UVesselSignificanceSubsystem.
+struct FSignificanceEntry
+{
+	TWeakObjectPtr<UObject> Object;
+
+	/// Tick interval the object was registered with, used while it is significant.
+	float BaseTickInterval = 0;
+
+	/// How much the object matters to gameplay, from 0 to 1. Scales its significance.
+	float Relevance = 1;
+
+	float Significance = 1;
+
+	bool bIsSignificant = true;
+
+	/// False for objects whose tick drives gameplay, only their cosmetic work is scaled back.
+	bool bThrottleTick = true;
+};
+
+/// Scores vessel effects and interactables by distance to the player's view, whether they were rendered recently and their
+/// gameplay relevance. Insignificant objects stop updating their decals and materials, and those registered with tick throttling
+/// also tick less often.
+/// Only MaxEvaluationsPerFrame objects are scored each frame, and at most MaxSignificant objects run at full rate.
+/// The tuning is read from the UVesselSignificanceSettings when the subsystem is initialized.
+UCLASS()
+class SPEEGYPT_API UVesselSignificanceSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	/// Returns the subsystem of the given world, or nullptr if there isn't one.
+	static UVesselSignificanceSubsystem* Get(const UWorld* World);
+
+	/// Starts managing the given actor or component. Its tick interval is only changed if bThrottleTick is set, leave it off for
+	/// anything whose tick moves or drives gameplay.
+	void Register(UObject* Object, float Relevance = 1, bool bThrottleTick = true);
+
+	/// Stops managing the object and puts its tick interval back.
+	void Unregister(UObject* Object);
+
+	/// While disabled every registered object runs at its base rate. Re-enabling rescores everything from scratch.
+	void SetEnabled(bool bEnabled);
+
+	bool IsEnabled() const { return bIsEnabled; }
+
+	/// See UVesselSignificanceSettings.
+	float MaxDistance = 8000;
+
+	float HiddenScale = 0.25f;
+
+	float SignificanceThreshold = 0.2f;
+
+	float MaxTickInterval = 1.f;
+
+	int MaxEvaluationsPerFrame = 32;
+
+	int MaxSignificant = 64;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	TArray<FSignificanceEntry> Entries;
+
+	/// Next entry to be scored, entries are scored round robin.
+	int NextEntry = 0;
+
+	int NumSignificant = 0;
+
+	bool bIsEnabled = true;
+
+	/// Scores the entry and applies its tick interval and decal updates.
+	void Evaluate(FSignificanceEntry& Entry, const FVector& ViewLocation);
+
+	/// Returns the significant entry with the lowest score, the one to give up its slot when the cap is full.
+	FSignificanceEntry* FindWeakestSignificant();
+
+	/// Tick interval of the entry for its current score and significance.
+	float GetTickInterval(const FSignificanceEntry& Entry) const;
+
+	void Apply(FSignificanceEntry& Entry, float TickInterval);
+};
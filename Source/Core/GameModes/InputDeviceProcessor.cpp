@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "InputDeviceProcessor.h"
+#include "Input/Events.h"
+
+void FInputDeviceProcessor::SetUsingGamepad(bool bGamepad)
+{
+	if (bIsUsingGamepad == bGamepad)
+		return;
+
+	bIsUsingGamepad = bGamepad;
+	OnInputDeviceChanged.Broadcast(bIsUsingGamepad);
+}
+
+bool FInputDeviceProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	if (InKeyEvent.GetKey().IsGamepadKey())
+		OnGamepadInput();
+	else
+		SetUsingGamepad(false);
+	return false;
+}
+
+bool FInputDeviceProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
+{
+	if (InAnalogInputEvent.GetKey().IsGamepadKey() && FMath::Abs(InAnalogInputEvent.GetAnalogValue()) > AnalogDeadZone)
+		OnGamepadInput();
+	return false;
+}
+
+bool FInputDeviceProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	if (!MouseEvent.GetCursorDelta().IsNearlyZero(MouseMoveThreshold))
+		SetUsingGamepad(false);
+	return false;
+}
+
+bool FInputDeviceProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	SetUsingGamepad(false);
+	return false;
+}
+
+bool FInputDeviceProcessor::HandleMouseWheelOrGestureEvent(FSlateApplication& SlateApp, const FPointerEvent& InWheelEvent, const FPointerEvent* InGestureEvent)
+{
+	SetUsingGamepad(false);
+	return false;
+}
+
+void FInputDeviceProcessor::OnGamepadInput()
+{
+	LastGamepadInputTime = FPlatformTime::Seconds();
+	SetUsingGamepad(true);
+}
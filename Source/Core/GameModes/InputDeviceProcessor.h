@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Application/IInputProcessor.h"
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInputDeviceChanged, bool /* bIsUsingGamepad */);
+
+/// Watches every input event before it reaches the game and works out whether the player is on a gamepad or on mouse and
+/// keyboard. OnInputDeviceChanged is only broadcast when that actually changes, so listeners don't need to poll.
+/// Never consumes any input.
+class SPEEGYPT_API FInputDeviceProcessor : public IInputProcessor
+{
+public:
+	/// Broadcast when the player switches between gamepad and mouse and keyboard.
+	FOnInputDeviceChanged OnInputDeviceChanged;
+
+	/// Stick movement below this is treated as drift and doesn't count as gamepad input.
+	float AnalogDeadZone = 0.25f;
+
+	/// Mouse movement below this many pixels doesn't count as mouse input.
+	float MouseMoveThreshold = 1.f;
+
+	bool IsUsingGamepad() const { return bIsUsingGamepad; }
+
+	/// Platform time of the last gamepad input, in seconds.
+	double GetLastGamepadInputTime() const { return LastGamepadInputTime; }
+
+	/// Sets the active device class, broadcasting if it changed.
+	void SetUsingGamepad(bool bGamepad);
+
+	// IInputProcessor
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent) override;
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseWheelOrGestureEvent(FSlateApplication& SlateApp, const FPointerEvent& InWheelEvent, const FPointerEvent* InGestureEvent) override;
+	// End of IInputProcessor
+
+protected:
+	bool bIsUsingGamepad = false;
+
+	double LastGamepadInputTime = 0;
+
+	void OnGamepadInput();
+};
@@ -2,6 +2,9 @@
 
 
 #include "SpeegyptPlayerController.h"
+#include "InputDeviceProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "TimerManager.h"
 
 ASpeegyptPlayerController::ASpeegyptPlayerController()
 {
@@ -12,29 +15,51 @@ ASpeegyptPlayerController::ASpeegyptPlayerController()
 	GamepadTimeout = 5.f;
 }
 
-bool ASpeegyptPlayerController::InputAxis(FKey Key, float Delta, float DeltaTime, int32 NumSamples, bool bGamepad)
+void ASpeegyptPlayerController::BeginPlay()
 {
-	bool ret = Super::InputAxis(Key, Delta, DeltaTime, NumSamples, bGamepad);
-	_UpdateGamepad(bGamepad);
-	return ret;
-}
+	Super::BeginPlay();
 
-bool ASpeegyptPlayerController::InputKey(FKey Key, EInputEvent EventType, float AmountDepressed, bool bGamepad)
-{
-	bool ret = Super::InputKey(Key, EventType, AmountDepressed, bGamepad);
-	_UpdateGamepad(bGamepad);
-	return ret;
+	if (IsLocalController() && FSlateApplication::IsInitialized())
+	{
+		InputDeviceProcessor = MakeShared<FInputDeviceProcessor>();
+		InputDeviceProcessor->OnInputDeviceChanged.AddUObject(this, &ASpeegyptPlayerController::HandleInputDeviceChanged);
+		FSlateApplication::Get().RegisterInputPreProcessor(InputDeviceProcessor);
+	}
 }
 
-void ASpeegyptPlayerController::PlayerTick(float DeltaTime)
+void ASpeegyptPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::PlayerTick(DeltaTime);
-	if (IsLocalController() && bResetGamepadDetectionAfterNoInput && bIsUsingGamepad)
+	if (InputDeviceProcessor.IsValid())
 	{
-		float now = GetWorld()->TimeSeconds;
-		if (now > LastGamepadInputTime + GamepadTimeout)
-		{
-			bIsUsingGamepad = false;
-		}
+		if (FSlateApplication::IsInitialized())
+			FSlateApplication::Get().UnregisterInputPreProcessor(InputDeviceProcessor);
+		InputDeviceProcessor->OnInputDeviceChanged.RemoveAll(this);
+		InputDeviceProcessor.Reset();
 	}
-}
\ No newline at end of file
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASpeegyptPlayerController::HandleInputDeviceChanged(bool bGamepad)
+{
+	bIsUsingGamepad = bGamepad;
+
+	if (bIsUsingGamepad && bResetGamepadDetectionAfterNoInput)
+		GetWorldTimerManager().SetTimer(GamepadTimeoutTimer, this, &ASpeegyptPlayerController::OnGamepadTimeout, GamepadTimeout);
+	else
+		GetWorldTimerManager().ClearTimer(GamepadTimeoutTimer);
+
+	OnInputDeviceChanged.Broadcast(bIsUsingGamepad);
+}
+
+void ASpeegyptPlayerController::OnGamepadTimeout()
+{
+	if (!InputDeviceProcessor.IsValid())
+		return;
+
+	float Remaining = InputDeviceProcessor->GetLastGamepadInputTime() + GamepadTimeout - FPlatformTime::Seconds();
+	if (Remaining > 0)
+		GetWorldTimerManager().SetTimer(GamepadTimeoutTimer, this, &ASpeegyptPlayerController::OnGamepadTimeout, Remaining);
+	else
+		InputDeviceProcessor->SetUsingGamepad(false);
+}
@@ -6,6 +6,10 @@
 #include "GameFramework/PlayerController.h"
 #include "SpeegyptPlayerController.generated.h"
 
+class FInputDeviceProcessor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInputDeviceChangedSignature, bool, bIsUsingGamepad);
+
 /**
  * 
  */
@@ -29,25 +33,23 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (EditCondition = "bResetGamepadDetectionAfterNoInput"))
 		float GamepadTimeout;
 
-
-	// Overrides
-	virtual bool InputAxis(FKey Key, float Delta, float DeltaTime, int32 NumSamples, bool bGamepad) override;
-	virtual bool InputKey(FKey Key, EInputEvent EventType, float AmountDepressed, bool bGamepad) override;
-	virtual void PlayerTick(float DeltaTime) override;
+	/** Called when the player switches between gamepad and mouse and keyboard. UI and prompts should listen to this instead of polling `bIsUsingGamepad`. */
+	UPROPERTY(BlueprintAssignable)
+		FOnInputDeviceChangedSignature OnInputDeviceChanged;
 
 protected:
 
-	/** Common logic needed in both `InputAxis()` and `InputKey()` */
-	FORCEINLINE void _UpdateGamepad(bool bGamepad)
-	{
-		bIsUsingGamepad = bGamepad;
-		if (bGamepad)
-		{
-			LastGamepadInputTime = GetWorld()->TimeSeconds;
-		}
-	}
-
-	// Used to keep track of when we last saw gamepad input
-	UPROPERTY(Transient, BlueprintReadOnly)
-		float LastGamepadInputTime;
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Sees every input event before the game does, and tells us when the active device changes */
+	TSharedPtr<FInputDeviceProcessor> InputDeviceProcessor;
+
+	FTimerHandle GamepadTimeoutTimer;
+
+	void HandleInputDeviceChanged(bool bGamepad);
+
+	/** Falls back to mouse and keyboard if there was no gamepad input for GamepadTimeout, otherwise waits for the rest of it */
+	void OnGamepadTimeout();
 };
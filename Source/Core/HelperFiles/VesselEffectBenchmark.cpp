@@ -0,0 +1,392 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VesselEffectBenchmark.h"
+#include "VesselStats.h"
+#include "../Equipment/VesselSignificanceSubsystem.h"
+#include "../Interactables/AllPurposeTargetContainer.h"
+#include "../Interactables/Beacons/SphereBeacon.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVesselBenchmark, Log, All);
+
+static FAutoConsoleCommandWithWorldAndArgs VesselBenchmarkCommand(
+	TEXT("Speegypt.VesselBenchmark"),
+	TEXT("Runs the vessel effect stress benchmark. Args: [Containers] [BeaconsPerColor] [Frames] [BudgetMs] [Class=BudgetMs...] [significance] [quit]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&AVesselEffectBenchmark::RunFromConsole));
+
+AVesselEffectBenchmark* AVesselEffectBenchmark::Running = nullptr;
+
+// Sets default values
+AVesselEffectBenchmark::AVesselEffectBenchmark()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// Everything the frame's effects and targets did has happened by the time this ticks
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+}
+
+void AVesselEffectBenchmark::RunFromConsole(const TArray<FString>& Args, UWorld* World)
+{
+	if (!World || !World->IsGameWorld())
+	{
+		UE_LOG(LogVesselBenchmark, Error, TEXT("The vessel benchmark has to be run in a game world."));
+		return;
+	}
+
+	if (Running)
+	{
+		UE_LOG(LogVesselBenchmark, Warning, TEXT("A vessel benchmark is already running."));
+		return;
+	}
+
+	AVesselEffectBenchmark* Benchmark = World->SpawnActorDeferred<AVesselEffectBenchmark>(AVesselEffectBenchmark::StaticClass(), FTransform::Identity);
+	if (!Benchmark)
+		return;
+
+	int32 NumericArg = 0;
+	for (auto& Arg : Args)
+	{
+		if (Arg.Equals(TEXT("quit"), ESearchCase::IgnoreCase))
+		{
+			Benchmark->bQuitWhenDone = true;
+			continue;
+		}
+		if (Arg.Equals(TEXT("significance"), ESearchCase::IgnoreCase))
+		{
+			Benchmark->bUseSignificance = true;
+			continue;
+		}
+
+		FString ClassName;
+		FString Budget;
+		if (Arg.Split(TEXT("="), &ClassName, &Budget))
+		{
+			Benchmark->ClassBudgets.Add(FName(*ClassName), FCString::Atof(*Budget));
+			continue;
+		}
+
+		switch (NumericArg++)
+		{
+		case 0: Benchmark->NumContainers = FMath::Max(FCString::Atoi(*Arg), 1); break;
+		case 1: Benchmark->BeaconsPerColor = FMath::Max(FCString::Atoi(*Arg), 0); break;
+		case 2: Benchmark->NumFrames = FMath::Max(FCString::Atoi(*Arg), 1); break;
+		case 3: Benchmark->TickBudget = FCString::Atof(*Arg); break;
+		default: break;
+		}
+	}
+
+	Benchmark->FinishSpawning(FTransform::Identity);
+}
+
+// Called when the game starts or when spawned
+void AVesselEffectBenchmark::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (Running)
+	{
+		Destroy();
+		return;
+	}
+
+	// Nothing is ever rendered in a headless run, so significance would throttle every effect and target in the benchmark
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance && !bUseSignificance && Significance->IsEnabled())
+	{
+		Significance->SetEnabled(false);
+		bDisabledSignificance = true;
+	}
+
+	SpawnWorld();
+	Running = this;
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &AVesselEffectBenchmark::OnPreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &AVesselEffectBenchmark::OnPostActorTick);
+	FVesselTickTimings::Begin();
+
+#if CSV_PROFILER
+	if (!FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->BeginCapture(-1, FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks")), FString::Printf(TEXT("VesselEffects-%s-Profile.csv"), *FDateTime::Now().ToString()));
+		bStartedCsvCapture = true;
+	}
+#endif
+
+	UE_LOG(LogVesselBenchmark, Log, TEXT("Running vessel benchmark: %d containers, %d beacons per colour, %d frames, significance %s."),
+		NumContainers, BeaconsPerColor, NumFrames, bDisabledSignificance ? TEXT("off") : TEXT("on"));
+}
+
+void AVesselEffectBenchmark::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (Running == this)
+	{
+		Running = nullptr;
+		FVesselTickTimings::End();
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+#if CSV_PROFILER
+	if (bStartedCsvCapture)
+		FCsvProfiler::Get()->EndCapture();
+	bStartedCsvCapture = false;
+#endif
+
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance && bDisabledSignificance)
+		Significance->SetEnabled(true);
+	bDisabledSignificance = false;
+
+	for (auto& Actor : SpawnedActors)
+	{
+		if (Actor)
+			Actor->Destroy();
+	}
+	SpawnedActors.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AVesselEffectBenchmark::SpawnWorld()
+{
+	UWorld* World = GetWorld();
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!World || !Cube)
+		return;
+
+	int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumContainers));
+	float GridExtent = GridSize * ContainerSpacing;
+	FVector Origin = GetActorLocation();
+
+	// Floor for the targets to land on once an effect stops holding them up
+	AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(Origin + FVector(GridExtent / 2, GridExtent / 2, -100), FRotator::ZeroRotator);
+	if (Floor)
+	{
+		Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Floor->SetActorScale3D(FVector(GridExtent / 50, GridExtent / 50, 1));
+		SpawnedActors.Add(Floor);
+	}
+
+	for (int32 i = 0; i < NumContainers; i++)
+		SpawnContainer(Cube, Origin + FVector((i % GridSize) * ContainerSpacing, (i / GridSize) * ContainerSpacing, 50));
+
+	// Beacons are dropped between the containers, their effect shapes overlapping several of them at once
+	FRandomStream Random(Seed);
+	const EVesselState Colors[] = { EVesselState::Cyan, EVesselState::Magenta, EVesselState::Yellow };
+	for (auto& Color : Colors)
+	{
+		for (int32 i = 0; i < BeaconsPerColor; i++)
+		{
+			FVector Location = Origin + FVector(Random.FRandRange(0, GridExtent), Random.FRandRange(0, GridExtent), 0);
+			ASphereBeacon* Beacon = World->SpawnActor<ASphereBeacon>(Location, FRotator::ZeroRotator);
+			if (Beacon)
+			{
+				Beacon->Vessel->SetVesselState(Color);
+				Beacons.Add(Beacon);
+				BeaconColors.Add(Color);
+				SpawnedActors.Add(Beacon);
+			}
+		}
+	}
+}
+
+void AVesselEffectBenchmark::SpawnContainer(UStaticMesh* Mesh, const FVector& Location)
+{
+	FTransform Transform(Location);
+	AAllPurposeTargetContainer* Container = GetWorld()->SpawnActorDeferred<AAllPurposeTargetContainer>(AAllPurposeTargetContainer::StaticClass(), Transform);
+	if (!Container)
+		return;
+
+	// The mesh has to exist before the targets gather their data and before they begin play
+	UStaticMeshComponent* TargetMesh = NewObject<UStaticMeshComponent>(Container, TEXT("TargetMesh"));
+	TargetMesh->SetMobility(EComponentMobility::Movable);
+	TargetMesh->SetStaticMesh(Mesh);
+	TargetMesh->SetSimulatePhysics(true);
+	Container->SetRootComponent(TargetMesh);
+	Container->AddInstanceComponent(TargetMesh);
+	TargetMesh->RegisterComponent();
+
+	TArray<UVesselTarget*> Targets;
+	Container->GetComponents<UVesselTarget>(Targets);
+	for (auto& Target : Targets)
+		Target->Init();
+
+	Container->FinishSpawning(Transform);
+
+	TargetMesh->OnComponentBeginOverlap.AddDynamic(this, &AVesselEffectBenchmark::OnTargetBeginOverlap);
+	TargetMesh->OnComponentEndOverlap.AddDynamic(this, &AVesselEffectBenchmark::OnTargetEndOverlap);
+	TargetMeshes.Add(TargetMesh);
+	LastPhysicsStates.Add(GetPhysicsState(TargetMesh));
+	SpawnedActors.Add(Container);
+}
+
+// Called every frame, after everything else has ticked
+void AVesselEffectBenchmark::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Running != this)
+		return;
+
+	SamplePhysicsStates();
+
+	Frame++;
+	if (Frame >= NumFrames)
+	{
+		bool bPassed = Finish();
+		Running = nullptr;
+
+		if (bQuitWhenDone)
+			FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+		else
+			Destroy();
+		return;
+	}
+
+	if (ToggleInterval > 0 && Frame % ToggleInterval == 0)
+		ToggleBeacons();
+}
+
+void AVesselEffectBenchmark::ToggleBeacons()
+{
+	for (int32 i = 0; i < Beacons.Num(); i++)
+	{
+		if (Beacons[i] && Beacons[i]->Vessel)
+		{
+			UVessel* Vessel = Beacons[i]->Vessel;
+			Vessel->SetVesselState(Vessel->GetVesselState() == EVesselState::Empty ? BeaconColors[i] : EVesselState::Empty);
+			StateToggles++;
+		}
+	}
+}
+
+void AVesselEffectBenchmark::SamplePhysicsStates()
+{
+	for (int32 i = 0; i < TargetMeshes.Num(); i++)
+	{
+		if (TargetMeshes[i])
+		{
+			uint8 State = GetPhysicsState(TargetMeshes[i]);
+			if (State != LastPhysicsStates[i])
+			{
+				PhysicsStateChanges++;
+				LastPhysicsStates[i] = State;
+			}
+		}
+	}
+}
+
+uint8 AVesselEffectBenchmark::GetPhysicsState(const UStaticMeshComponent* Mesh)
+{
+	return (Mesh->IsSimulatingPhysics() ? 1 : 0) | (Mesh->IsGravityEnabled() ? 2 : 0) | ((uint8)Mesh->GetCollisionEnabled() << 2);
+}
+
+bool AVesselEffectBenchmark::Finish()
+{
+	double Average = TotalTickSeconds * 1000.0 / FMath::Max(TickedFrames, 1);
+	bool bPassed = Average <= TickBudget;
+
+	FString Csv = TEXT("Category,Name,Count,TotalMs,AvgMsPerFrame,PeakMsPerFrame,BudgetMs,Result\n");
+	Csv += FString::Printf(TEXT("Tick,World,%d,%.4f,%.4f,%.4f,%.4f,%s\n"), TickedFrames, TotalTickSeconds * 1000.0,
+		Average, PeakTickSeconds * 1000.0, TickBudget, bPassed ? TEXT("Pass") : TEXT("Fail"));
+
+	if (!bPassed)
+		UE_LOG(LogVesselBenchmark, Error, TEXT("The world's ticks averaged %.4fms per frame, over the %.4fms budget."), Average, TickBudget);
+
+	// Each class is timed including the parent classes it calls into, so a child's time also shows up under its parent
+	FVesselTickTimings::End();
+	TArray<FName> ClassNames;
+	FVesselTickTimings::Get().GenerateKeyArray(ClassNames);
+	ClassNames.Sort(FNameLexicalLess());
+	for (auto& Name : ClassNames)
+	{
+		const FVesselTickTiming& Timing = FVesselTickTimings::Get().FindChecked(Name);
+		double ClassTotal = FPlatformTime::ToMilliseconds64(Timing.Cycles);
+		double ClassAverage = ClassTotal / FMath::Max(TickedFrames, 1);
+		const float* Budget = ClassBudgets.Find(Name);
+		float ClassBudget = Budget ? *Budget : DefaultClassBudget;
+		bool bClassPassed = ClassAverage <= ClassBudget;
+
+		Csv += FString::Printf(TEXT("Class,%s,%d,%.4f,%.4f,%.4f,%.4f,%s\n"), *Name.ToString(), Timing.Calls, ClassTotal,
+			ClassAverage, PeakClassSeconds.FindRef(Name) * 1000.0, ClassBudget, bClassPassed ? TEXT("Pass") : TEXT("Fail"));
+
+		if (!bClassPassed)
+		{
+			UE_LOG(LogVesselBenchmark, Error, TEXT("%s ticks averaged %.4fms per frame, over the %.4fms budget."), *Name.ToString(), ClassAverage, ClassBudget);
+			bPassed = false;
+		}
+	}
+
+	Csv += FString::Printf(TEXT("Events,OverlapBegin,%d,,,,,\n"), OverlapBeginEvents);
+	Csv += FString::Printf(TEXT("Events,OverlapEnd,%d,,,,,\n"), OverlapEndEvents);
+	Csv += FString::Printf(TEXT("Events,PhysicsStateChanges,%d,,,,,\n"), PhysicsStateChanges);
+	Csv += FString::Printf(TEXT("Events,StateToggles,%d,,,,,\n"), StateToggles);
+	Csv += FString::Printf(TEXT("Setup,Containers,%d,,,,,\n"), TargetMeshes.Num());
+	Csv += FString::Printf(TEXT("Setup,Beacons,%d,,,,,\n"), Beacons.Num());
+	Csv += FString::Printf(TEXT("Setup,Frames,%d,,,,,\n"), Frame);
+	Csv += FString::Printf(TEXT("Setup,Significance,%d,,,,,\n"), bDisabledSignificance ? 0 : 1);
+
+#if CSV_PROFILER
+	// The CSV profile has the same classes frame by frame, under the VesselEffects category
+	if (bStartedCsvCapture)
+	{
+		FCsvProfiler::Get()->EndCapture();
+		bStartedCsvCapture = false;
+	}
+#endif
+
+	FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), FString::Printf(TEXT("VesselEffects-%s.csv"), *FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(Csv, *Path))
+		UE_LOG(LogVesselBenchmark, Log, TEXT("Vessel benchmark results written to %s"), *Path);
+	else
+		UE_LOG(LogVesselBenchmark, Error, TEXT("Couldn't write the vessel benchmark results to %s"), *Path);
+
+	UE_LOG(LogVesselBenchmark, Log, TEXT("Vessel benchmark %s."), bPassed ? TEXT("passed") : TEXT("failed"));
+	return bPassed;
+}
+
+void AVesselEffectBenchmark::OnPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld() && Running == this)
+		TickStartTime = FPlatformTime::Seconds();
+}
+
+void AVesselEffectBenchmark::OnPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || Running != this || TickStartTime <= 0)
+		return;
+
+	double Seconds = FPlatformTime::Seconds() - TickStartTime;
+	TotalTickSeconds += Seconds;
+	PeakTickSeconds = FMath::Max(PeakTickSeconds, Seconds);
+	TickedFrames++;
+	TickStartTime = 0;
+
+	for (auto& Entry : FVesselTickTimings::Get())
+	{
+		uint64& LastCycles = LastClassCycles.FindOrAdd(Entry.Key);
+		double& PeakSeconds = PeakClassSeconds.FindOrAdd(Entry.Key);
+		PeakSeconds = FMath::Max(PeakSeconds, FPlatformTime::ToSeconds64(Entry.Value.Cycles - LastCycles));
+		LastCycles = Entry.Value.Cycles;
+	}
+}
+
+void AVesselEffectBenchmark::OnTargetBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	OverlapBeginEvents++;
+}
+
+void AVesselEffectBenchmark::OnTargetEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	OverlapEndEvents++;
+}
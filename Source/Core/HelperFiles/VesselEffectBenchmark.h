@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "../Equipment/VesselEnums.h"
+#include "VesselEffectBenchmark.generated.h"
+
+class ABeacon;
+class UStaticMesh;
+class UStaticMeshComponent;
+
+/// Stress benchmark for the vessel effects. Spawns a grid of target containers and a number of beacons of each passive colour around it,
+/// then toggles the beacons on and off while the world steps frames. The world's tick time, the tick time of every effect and target class
+/// timed with VESSEL_SCOPED_TICK_STATS, the overlap events and the physics state changes of the targets are written to Saved/Benchmarks as
+/// CSV. The run fails if the world goes over TickBudget or any class goes over its own budget. A CSV profile is captured alongside it,
+/// holding the same classes frame by frame under the VesselEffects category.
+/// Started with the Speegypt.VesselBenchmark console command, so it can be run headless with -game -nullrhi -ExecCmds.
+UCLASS(NotBlueprintable)
+class SPEEGYPT_API AVesselEffectBenchmark : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	AVesselEffectBenchmark();
+
+	/// Number of target containers, laid out in a square grid.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 NumContainers = 100;
+
+	/// Number of beacons spawned for each of the cyan, magenta and yellow states.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 BeaconsPerColor = 10;
+
+	/// Number of frames stepped before the results are written.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 NumFrames = 600;
+
+	/// Every beacon swaps between its colour and empty this many frames.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 ToggleInterval = 30;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float ContainerSpacing = 300;
+
+	/// Highest average time per frame, in milliseconds, the world's actor and component ticks may take before the run fails. Includes physics.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float TickBudget = 8.f;
+
+	/// Highest average time per frame, in milliseconds, a single effect or target class may take, for classes without an entry in ClassBudgets.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float DefaultClassBudget = 1.f;
+
+	/// Budget in milliseconds of each class, by the name it is timed under, e.g. CyanVesselEffect.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	TMap<FName, float> ClassBudgets;
+
+	/// Leaves the UVesselSignificanceSubsystem running. Off by default, headless runs never render anything so it would throttle every object.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	bool bUseSignificance = false;
+
+	/// Seed used to place the beacons, so runs with the same settings are comparable.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 Seed = 1;
+
+	/// Quits the game with a non zero exit code on failure once the results are written. Used by automated runs.
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	bool bQuitWhenDone = false;
+
+	/// Handler of the Speegypt.VesselBenchmark console command. Takes the container count, beacons per colour, frame count and
+	/// budget in milliseconds in that order, all optional, along with the "significance" and "quit" switches. Class budgets are
+	/// given as Class=Ms, e.g. CyanVesselEffect=0.5.
+	static void RunFromConsole(const TArray<FString>& Args, UWorld* World);
+
+	/// Benchmark currently collecting samples, if any.
+	static AVesselEffectBenchmark* Running;
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UPROPERTY()
+	TArray<AActor*> SpawnedActors;
+
+	UPROPERTY()
+	TArray<ABeacon*> Beacons;
+
+	/// State each beacon is given when toggled on, parallel to Beacons.
+	TArray<EVesselState> BeaconColors;
+
+	UPROPERTY()
+	TArray<UStaticMeshComponent*> TargetMeshes;
+
+	/// Physics flags of each target mesh last frame, parallel to TargetMeshes.
+	TArray<uint8> LastPhysicsStates;
+
+	/// Time the world spent ticking actors and components, measured between the pre and post actor tick delegates.
+	double TickStartTime = 0;
+
+	double TotalTickSeconds = 0;
+
+	double PeakTickSeconds = 0;
+
+	int32 TickedFrames = 0;
+
+	/// Cycles each class had summed at the end of the last frame, to take the frame's share out of FVesselTickTimings.
+	TMap<FName, uint64> LastClassCycles;
+
+	TMap<FName, double> PeakClassSeconds;
+
+	FDelegateHandle PreActorTickHandle;
+
+	FDelegateHandle PostActorTickHandle;
+
+	/// True if this run turned the significance subsystem off, it is turned back on when the benchmark ends.
+	bool bDisabledSignificance = false;
+
+	/// True if this run started the CSV profiler, it is stopped when the results are written.
+	bool bStartedCsvCapture = false;
+
+	int32 Frame = 0;
+
+	int32 OverlapBeginEvents = 0;
+
+	int32 OverlapEndEvents = 0;
+
+	int32 PhysicsStateChanges = 0;
+
+	int32 StateToggles = 0;
+
+	void SpawnWorld();
+
+	/// Spawns a container holding every target type around a single cube.
+	void SpawnContainer(UStaticMesh* Mesh, const FVector& Location);
+
+	void ToggleBeacons();
+
+	/// Counts the target meshes whose simulation, gravity or collision changed since last frame.
+	void SamplePhysicsStates();
+
+	static uint8 GetPhysicsState(const UStaticMeshComponent* Mesh);
+
+	/// Writes the CSV and checks the budgets. Returns false if the world's or any class's tick time went over its budget.
+	bool Finish();
+
+	void OnPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/// Adds the frame's tick time of the world and of every class.
+	void OnPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	UFUNCTION()
+	void OnTargetBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnTargetEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+public:
+	// Called every frame, after everything else has ticked
+	virtual void Tick(float DeltaTime) override;
+};
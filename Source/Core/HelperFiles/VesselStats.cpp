@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VesselStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(SPEEGYPT_API, VesselEffects, true);
+
+bool FVesselTickTimings::bCollecting = false;
+
+TMap<FName, FVesselTickTiming> FVesselTickTimings::Timings;
+
+void FVesselTickTimings::Begin()
+{
+	Timings.Reset();
+	bCollecting = true;
+}
+
+void FVesselTickTimings::End()
+{
+	bCollecting = false;
+}
+
+void FVesselTickTimings::Add(FName Name, uint64 Cycles)
+{
+	// the components tick on the game thread, anything else would race on the map
+	if (!IsInGameThread())
+		return;
+
+	FVesselTickTiming& Timing = Timings.FindOrAdd(Name);
+	Timing.Cycles += Cycles;
+	Timing.Calls++;
+}
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/PlatformTime.h"
+
+/// Tick costs of the vessel effects and targets, shown with "stat VesselEffects" and written to CSV profiles under the VesselEffects category.
+DECLARE_STATS_GROUP(TEXT("VesselEffects"), STATGROUP_VesselEffects, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SPEEGYPT_API, VesselEffects);
+
+/// Tick time summed for one effect or target class. Includes the ticks of the parent classes it calls into, same as the stats.
+struct FVesselTickTiming
+{
+	uint64 Cycles = 0;
+
+	int32 Calls = 0;
+};
+
+/// Sums the tick time of every effect and target class on the game thread while collecting, for the AVesselEffectBenchmark to
+/// report and budget each class on its own. Costs a single branch per tick otherwise, and is there in every build configuration.
+class SPEEGYPT_API FVesselTickTimings
+{
+public:
+	/// Clears the timings and starts summing.
+	static void Begin();
+
+	static void End();
+
+	static bool IsCollecting() { return bCollecting; }
+
+	static void Add(FName Name, uint64 Cycles);
+
+	static const TMap<FName, FVesselTickTiming>& Get() { return Timings; }
+
+private:
+	static bool bCollecting;
+
+	static TMap<FName, FVesselTickTiming> Timings;
+};
+
+/// Adds the time spent in the enclosing scope to the named class while FVesselTickTimings is collecting.
+class FVesselScopedTickTiming
+{
+public:
+	explicit FVesselScopedTickTiming(FName InName)
+		: Name(InName)
+		, StartCycles(FVesselTickTimings::IsCollecting() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FVesselScopedTickTiming()
+	{
+		if (StartCycles)
+			FVesselTickTimings::Add(Name, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+private:
+	FName Name;
+
+	uint64 StartCycles;
+};
+
+/// Times the enclosing tick for "stat VesselEffects", the CSV profile and the vessel benchmark. Name is the class name without its prefix.
+#define VESSEL_SCOPED_TICK_STATS(Stat, Name) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(VesselEffects, Name); \
+	static const FName PREPROCESSOR_JOIN(VesselTickTimingName, __LINE__)(TEXT(#Name)); \
+	FVesselScopedTickTiming PREPROCESSOR_JOIN(VesselTickTiming, __LINE__)(PREPROCESSOR_JOIN(VesselTickTimingName, __LINE__))
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
+#include "InteractableActor.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/MagentaVesselTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/CyanVesselTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/YellowVesselTarget.h"
@@ -14,7 +14,7 @@
 #include "AllPurposeTargetContainer.generated.h"
 
 UCLASS()
-class SPEEGYPT_API AAllPurposeTargetContainer : public AActor
+class SPEEGYPT_API AAllPurposeTargetContainer : public AInteractableActor
 {
 	GENERATED_BODY()
 
@@ -40,13 +40,4 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 		UCyanVesselTarget* CyanTarget;
 
-
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-public:
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 };
@@ -9,9 +9,6 @@
 // Sets default values
 ABeacon::ABeacon()
 {
-	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.TickInterval = 0.5;
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 
 
@@ -40,7 +37,7 @@ ABeacon::ABeacon()
 
 	Vessel->SetVesselState(EVesselState::Empty);
 
-	Vessel->Effects.CyanEffect->ForceMagnitude = 100;
+	Vessel->CyanForceMagnitude = 100;
 }
 
 void ABeacon::OnVesselColorUpdate()
@@ -58,20 +55,18 @@ void ABeacon::BeginPlay()
 	OnVesselColorUpdate();
 }
 
-// Called every frame
-void ABeacon::Tick(float DeltaTime)
-{	// This ticks even when the game isn't running so that the material updates without having to press play.
-	Super::Tick(DeltaTime);
+void ABeacon::OnConstruction(const FTransform& Transform)
+{	// Also runs when the beacon or its vessel is edited, so the material updates without having to press play.
+	Super::OnConstruction(Transform);
 
-#if WITH_EDITOR
-	Vessel->UpdateColor();
+	if (Vessel && Vessel->VesselMesh)
+		Vessel->UpdateColor();
 	OnVesselColorUpdate();
-#endif
 }
 
 void ABeacon::OnInteract_Implementation(ASpeegyptCharacter* Player)
 {
-	if (Player)
+	if (Player && Vessel->IsStateAllowed(Player->RightVessel->GetVesselState()) && Player->RightVessel->IsStateAllowed(Vessel->GetVesselState()))
 	{
 		EVesselState TempState = Vessel->GetVesselState();
 		Vessel->SetVesselState(Player->RightVessel->GetVesselState());
@@ -80,8 +75,12 @@ void ABeacon::OnInteract_Implementation(ASpeegyptCharacter* Player)
 }
 
 #if WITH_EDITOR
-bool ABeacon::ShouldTickIfViewportsOnly() const
-{	// Sets this class up to tick even when the game isnt running.
-	return true;
+void ABeacon::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (Vessel && Vessel->VesselMesh)
+		Vessel->UpdateColor();
+	OnVesselColorUpdate();
 }
 #endif
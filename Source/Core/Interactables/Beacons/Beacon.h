@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
+#include "../InteractableActor.h"
 #include "../Interactable.h"
 #include "../../Equipment/VesselEnums.h"
 #include "../../Equipment/Vessel.h"
@@ -11,7 +11,7 @@
 
 
 UCLASS(ABSTRACT)
-class SPEEGYPT_API ABeacon : public AActor, public IInteractable
+class SPEEGYPT_API ABeacon : public AInteractableActor, public IInteractable
 {
 	GENERATED_BODY()
 	
@@ -28,8 +28,11 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite)
 	UVessel* Vessel;
 
+	/// Refreshes the beacon's colour, so it is right in the editor without ticking.
+	virtual void OnConstruction(const FTransform& Transform) override;
+
 #if WITH_EDITOR
-	virtual bool ShouldTickIfViewportsOnly() const override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
 	virtual void OnInteract_Implementation(ASpeegyptCharacter* Player) override;
@@ -51,9 +54,4 @@ protected:
 
 	//UPROPERTY()
 	//EVesselState StartupState;
-
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 };
@@ -6,8 +6,6 @@
 // Sets default values
 ABoxBeacon::ABoxBeacon()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
 	Vessel->SetEffectShapeType(EEffectShapeType::Box);
 }
 
@@ -18,10 +16,3 @@ void ABoxBeacon::BeginPlay()
 	
 }
 
-// Called every frame
-void ABoxBeacon::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
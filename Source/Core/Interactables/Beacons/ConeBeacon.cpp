@@ -6,8 +6,6 @@
 // Sets default values
 AConeBeacon::AConeBeacon()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
 	Vessel->SetEffectShapeType(EEffectShapeType::Cone);
 }
 
@@ -18,10 +16,3 @@ void AConeBeacon::BeginPlay()
 	
 }
 
-// Called every frame
-void AConeBeacon::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
@@ -3,13 +3,12 @@
 
 #include "PhysicsBeacon.h"
 #include "PhysicsBeaconSlot.h"
+#include "PhysicsEngine/PhysicsHandleComponent.h"
+#include "TimerManager.h"
 
 // Sets default values
 APhysicsBeacon::APhysicsBeacon()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-
 	static ConstructorHelpers::FObjectFinder<UStaticMesh> PhysicsMeshFinder(TEXT("StaticMesh'/Game/Speegypt/Environment/Props/SM_Beacon_Physics.SM_Beacon_Physics'"));
 	if (PhysicsMeshFinder.Object)
 	{
@@ -17,6 +16,7 @@ APhysicsBeacon::APhysicsBeacon()
 		BeaconMesh->SetMaterial(0, Vessel->VesselMesh->GetMaterial(0));
 		BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_GameTraceChannel2, ECollisionResponse::ECR_Block); // interact block
 		BeaconMesh->SetSimulatePhysics(true);
+		BeaconMesh->SetGenerateOverlapEvents(true);
 		BeaconMesh->SetupAttachment(Root);
 	}
 	Vessel->SetRelativeLocation(FVector(0, 0, 0));
@@ -39,31 +39,68 @@ void APhysicsBeacon::BeginPlay()
 	Super::BeginPlay();
 }
 
-// Called every frame
-void APhysicsBeacon::Tick(float DeltaTime)
+void APhysicsBeacon::OnFallingTimerExpired()
 {
-	Super::Tick(DeltaTime);
-#if WITH_EDITOR
-	if (!HasActorBegunPlay())
-		if(BeaconMesh && Vessel && Vessel->VesselMesh)
-			BeaconMesh->SetMaterial(0, Vessel->VesselMesh->GetMaterial(0));
-#endif
-	if (FallingTimer > 0)
+	BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Block);
+}
+
+APhysicsBeaconSlot* APhysicsBeacon::GetBestSlotInRange(const FVector& ViewLocation, const FVector& ViewDirection) const
+{
+	APhysicsBeaconSlot* BestSlot = nullptr;
+	float BestDot = -1;
+	for (APhysicsBeaconSlot* Slot : SlotsInRange)
 	{
-		FallingTimer -= DeltaTime;
-		if (FallingTimer <= 0)
-			BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Block);
+		if (!Slot || Slot->GetAttachedBeacon())
+			continue;
+
+		float Dot = FVector::DotProduct(ViewDirection, (Slot->RestingPoint->GetComponentLocation() - ViewLocation).GetSafeNormal());
+		if (Dot > BestDot)
+		{
+			BestDot = Dot;
+			BestSlot = Slot;
+		}
 	}
+	return BestSlot;
+}
+
+void APhysicsBeacon::AddSlotInRange(APhysicsBeaconSlot* Slot)
+{
+	SlotsInRange.AddUnique(Slot);
+}
+
+void APhysicsBeacon::RemoveSlotInRange(APhysicsBeaconSlot* Slot)
+{
+	SlotsInRange.RemoveSingleSwap(Slot);
 }
 
 bool APhysicsBeacon::OnGrabBegin(ASpeegyptCharacter* Player)
 {
+	if (bUsePhysicsHandle && Player->PhysicsHandle)
+	{
+		// The body stays simulating while it is carried, the handle just drags it towards the held position.
+		GetWorldTimerManager().ClearTimer(FallingTimer);
+		BeaconMesh->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		BeaconMesh->SetWorldScale3D(FVector(0.25));
+		BeaconMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore);
+		BeaconMesh->SetSimulatePhysics(true);
+		Player->PhysicsHandle->GrabComponentAtLocationWithRotation(BeaconMesh, NAME_None, BeaconMesh->GetComponentLocation(), BeaconMesh->GetComponentRotation());
+
+		return true;
+	}
+
 	EAttachmentRule RuleLocation = EAttachmentRule::SnapToTarget;
 	EAttachmentRule RuleRotation = EAttachmentRule::SnapToTarget;
 	EAttachmentRule RuleScale = EAttachmentRule::KeepWorld;
 	FAttachmentTransformRules Rules = FAttachmentTransformRules(RuleLocation, RuleRotation, RuleScale, true);
 	BeaconMesh->SetSimulatePhysics(false);
-	BeaconMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	// Only overlap the channels slot snap volumes use while held, so the beacon still reaches them without getting in the way of anything else.
+	HeldCollisionResponses = BeaconMesh->GetCollisionResponseToChannels();
+	BeaconMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	BeaconMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+	BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_WorldDynamic, ECollisionResponse::ECR_Overlap);
+	BeaconMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_PhysicsBody, ECollisionResponse::ECR_Overlap);
 	BeaconMesh->AttachToComponent(Player->HeldObjectPosition, Rules);
 	BeaconMesh->SetWorldScale3D(FVector(0.15, 0.15, 0.15));
 
@@ -72,24 +109,48 @@ bool APhysicsBeacon::OnGrabBegin(ASpeegyptCharacter* Player)
 
 bool APhysicsBeacon::OnGrabEnd(ASpeegyptCharacter* Player)
 {
-	FHitResult Hit;
+	bool bHeldByHandle = Player->PhysicsHandle && Player->PhysicsHandle->GetGrabbedComponent() == BeaconMesh;
+
 	FVector Position = Player->GetFirstPersonCameraComponent()->GetComponentLocation();
 	FVector Forward = Player->GetFirstPersonCameraComponent()->GetForwardVector();
+
+	APhysicsBeaconSlot* Slot = GetBestSlotInRange(Position, Forward);
+	if (Slot)
+	{
+		if (bHeldByHandle)
+			Player->PhysicsHandle->ReleaseComponent();
+		else
+			BeaconMesh->SetCollisionResponseToChannels(HeldCollisionResponses);
+		Slot->TakePhysicsBeacon(this);
+		return true;
+	}
+
+	if (bHeldByHandle)
+	{
+		Player->PhysicsHandle->ReleaseComponent();
+		BeaconMesh->SetPhysicsLinearVelocity(FVector(0, 0, 0));
+
+		GetWorldTimerManager().SetTimer(FallingTimer, this, &APhysicsBeacon::OnFallingTimerExpired, FallingTime);
+
+		return true;
+	}
+
+	// An attached beacon is moved in front of the player when it is dropped, so make sure there is room for it.
+	FCollisionQueryParams Params;
+	Params.AddIgnoredActor(this);
+	Params.AddIgnoredActor(Player);
+
+	FHitResult Hit;
 	if (GetWorld()->SweepSingleByChannel(Hit,
 		Position,
 		150 * Forward + Position,
 		Player->GetActorRotation().Quaternion(),
 		ECollisionChannel::ECC_Visibility,
-		FCollisionShape::MakeSphere(BeaconMesh->Bounds.SphereRadius)))
-	{
-		APhysicsBeaconSlot* Slot = Cast<APhysicsBeaconSlot>(Hit.Actor);
-		if (Slot)
-		{
-			Slot->TakePhysicsBeacon(this);
-			return true;
-		}
+		FCollisionShape::MakeSphere(BeaconMesh->Bounds.SphereRadius),
+		Params))
 		return false;
-	}
+
+	BeaconMesh->SetCollisionResponseToChannels(HeldCollisionResponses);
 	BeaconMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 
 	EDetachmentRule Rule = EDetachmentRule::KeepWorld;
@@ -105,14 +166,7 @@ bool APhysicsBeacon::OnGrabEnd(ASpeegyptCharacter* Player)
 
 	BeaconMesh->SetPhysicsLinearVelocity(FVector(0, 0, 0));
 
-	FallingTimer = 1;
-
-	return true;
-}
+	GetWorldTimerManager().SetTimer(FallingTimer, this, &APhysicsBeacon::OnFallingTimerExpired, FallingTime);
 
-#if WITH_EDITOR
-bool APhysicsBeacon::ShouldTickIfViewportsOnly() const
-{	// Sets this class up to tick even when the game isnt running.
 	return true;
 }
-#endif
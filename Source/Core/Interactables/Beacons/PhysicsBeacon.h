@@ -8,6 +8,8 @@
 #include "../GrabbableObject.h"
 #include "PhysicsBeacon.generated.h"
 
+class APhysicsBeaconSlot;
+
 UCLASS()
 class SPEEGYPT_API APhysicsBeacon : public ABeacon, public IGrabbableObject
 {
@@ -19,6 +21,16 @@ public:
 
 	virtual void OnConstruction(const FTransform& Transform) override;
 
+	/// Returns the empty slot in range that is closest to the middle of the given view, or nullptr if there isn't one.
+	UFUNCTION(BlueprintCallable)
+	APhysicsBeaconSlot* GetBestSlotInRange(const FVector& ViewLocation, const FVector& ViewDirection) const;
+
+	/// Called by slots when the beacon enters their snap volume.
+	void AddSlotInRange(APhysicsBeaconSlot* Slot);
+
+	/// Called by slots when the beacon leaves their snap volume.
+	void RemoveSlotInRange(APhysicsBeaconSlot* Slot);
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -26,19 +38,28 @@ protected:
 	UPROPERTY()
 	bool bDynamicFlag = true;
 
-	UPROPERTY()
-	float FallingTimer = 0;
+	/// Carries the beacon with the player's physics handle instead of attaching it to their hand. The body keeps simulating
+	/// while it is held, so grabbing and dropping it doesn't rebuild its physics state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bUsePhysicsHandle = true;
 
-	virtual bool OnGrabBegin(ASpeegyptCharacter* Player) override;
+	/// How long a dropped beacon lets the player walk through it, so it doesn't knock them around while it settles.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float FallingTime = 1;
 
-	virtual bool OnGrabEnd(ASpeegyptCharacter* Player) override;
+	FTimerHandle FallingTimer;
 
-#if WITH_EDITOR
-	virtual bool ShouldTickIfViewportsOnly() const override;
-#endif
+	/// Slots whose snap volume the beacon is overlapping.
+	UPROPERTY()
+	TArray<APhysicsBeaconSlot*> SlotsInRange;
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	/// Collision responses the beacon had before it was attached to the player's hand, restored when it is let go.
+	FCollisionResponseContainer HeldCollisionResponses;
+
+	/// Makes the beacon block the player again once it has had time to fall.
+	void OnFallingTimerExpired();
 
+	virtual bool OnGrabBegin(ASpeegyptCharacter* Player) override;
+
+	virtual bool OnGrabEnd(ASpeegyptCharacter* Player) override;
 };
@@ -7,26 +7,41 @@
 // Sets default values
 APhysicsBeaconSlot::APhysicsBeaconSlot()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = false;
-
 	SlotMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("SlotMesh"));
 
 	RestingPoint = CreateDefaultSubobject<USceneComponent>(TEXT("RestingPoint"));
+
+	SnapVolume = CreateDefaultSubobject<USphereComponent>(TEXT("SnapVolume"));
+	SnapVolume->SetupAttachment(SlotMesh);
+	SnapVolume->SetSphereRadius(150);
+	SnapVolume->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	SnapVolume->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
+	SnapVolume->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+	SnapVolume->SetCollisionResponseToChannel(ECollisionChannel::ECC_WorldDynamic, ECollisionResponse::ECR_Overlap);
+	SnapVolume->SetCollisionResponseToChannel(ECollisionChannel::ECC_PhysicsBody, ECollisionResponse::ECR_Overlap);
 }
 
 // Called when the game starts or when spawned
 void APhysicsBeaconSlot::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	SnapVolume->OnComponentBeginOverlap.AddDynamic(this, &APhysicsBeaconSlot::OnSnapVolumeBeginOverlap);
+	SnapVolume->OnComponentEndOverlap.AddDynamic(this, &APhysicsBeaconSlot::OnSnapVolumeEndOverlap);
 }
 
-// Called every frame
-void APhysicsBeaconSlot::Tick(float DeltaTime)
+void APhysicsBeaconSlot::OnSnapVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	Super::Tick(DeltaTime);
+	APhysicsBeacon* Beacon = Cast<APhysicsBeacon>(OtherActor);
+	if (Beacon && OtherComp == Beacon->BeaconMesh)
+		Beacon->AddSlotInRange(this);
+}
 
+void APhysicsBeaconSlot::OnSnapVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	APhysicsBeacon* Beacon = Cast<APhysicsBeacon>(OtherActor);
+	if (Beacon && OtherComp == Beacon->BeaconMesh)
+		Beacon->RemoveSlotInRange(this);
 }
 
 void APhysicsBeaconSlot::TakePhysicsBeacon(APhysicsBeacon* BeaconToTake)
@@ -38,6 +53,8 @@ void APhysicsBeaconSlot::TakePhysicsBeacon(APhysicsBeacon* BeaconToTake)
 		EAttachmentRule RuleScale = EAttachmentRule::KeepWorld;
 		FAttachmentTransformRules Rules = FAttachmentTransformRules(RuleLocation, RuleRotation, RuleScale, true);
 
+		BeaconToTake->BeaconMesh->SetSimulatePhysics(false);
+		BeaconToTake->BeaconMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		BeaconToTake->BeaconMesh->SetWorldScale3D(FVector(0.5, 0.5, 0.5));
 		BeaconToTake->BeaconMesh->AttachToComponent(RestingPoint, Rules);
 		PhysicsBeacon = BeaconToTake;
@@ -3,14 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "../InteractableActor.h"
 #include "../Interactable.h"
-#include "GameFramework/Actor.h"
+#include "Components/SphereComponent.h"
 #include "PhysicsBeaconSlot.generated.h"
 
 class APhysicsBeacon;
 
 UCLASS()
-class SPEEGYPT_API APhysicsBeaconSlot : public AActor, public IInteractable
+class SPEEGYPT_API APhysicsBeaconSlot : public AInteractableActor, public IInteractable
 {
 	GENERATED_BODY()
 	
@@ -24,16 +25,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	UStaticMeshComponent* SlotMesh;
 
+	/// Physics beacons inside this volume can be dropped into the slot.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	USphereComponent* SnapVolume;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
 	APhysicsBeacon* PhysicsBeacon;
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	UFUNCTION()
+	void OnSnapVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	UFUNCTION()
+	void OnSnapVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+public:	
 	void TakePhysicsBeacon(APhysicsBeacon* BeaconToTake);
 
 	virtual void OnInteract_Implementation(ASpeegyptCharacter* Player) override;
@@ -14,7 +14,7 @@ class SPEEGYPT_API APushBeacon : public APhysicsBeacon
 	
 public:	
 	// Sets default values for this actor's properties
-	APushBeacon() { PrimaryActorTick.bCanEverTick = true; };
+	APushBeacon() {};
 
 	virtual void OnConstruction(const FTransform& Transform) override { Super::OnConstruction(Transform); BeaconMesh->SetWorldScale3D(FVector(0.75)); };
 
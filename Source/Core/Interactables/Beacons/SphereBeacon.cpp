@@ -6,8 +6,6 @@
 // Sets default values
 ASphereBeacon::ASphereBeacon()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
 	Vessel->SetEffectShapeType(EEffectShapeType::Sphere);
 }
 
@@ -18,10 +16,3 @@ void ASphereBeacon::BeginPlay()
 	
 }
 
-// Called every frame
-void ASphereBeacon::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
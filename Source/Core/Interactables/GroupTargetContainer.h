@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
+#include "InteractableActor.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/GroupTargets/CyanGroupTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/GroupTargets/YellowGroupTarget.h"
 
@@ -11,7 +11,7 @@
 #include "GroupTargetContainer.generated.h"
 
 UCLASS()
-class SPEEGYPT_API AGroupTargetContainer : public AActor
+class SPEEGYPT_API AGroupTargetContainer : public AInteractableActor
 {
 	GENERATED_BODY()
 
@@ -25,13 +25,4 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 		UCyanGroupTarget* CyanTarget;
 
-
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-public:
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 };
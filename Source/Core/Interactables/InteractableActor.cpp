@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "InteractableActor.h"
+#include "../Equipment/VesselSignificanceSubsystem.h"
+
+// Sets default values
+AInteractableActor::AInteractableActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+}
+
+// Called when the game starts or when spawned
+void AInteractableActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!PrimaryActorTick.bCanEverTick || !bThrottleTickBySignificance)
+		return;
+
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance)
+		Significance->Register(this, SignificanceRelevance);
+}
+
+void AInteractableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVesselSignificanceSubsystem* Significance = UVesselSignificanceSubsystem::Get(GetWorld());
+	if (Significance)
+		Significance->Unregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "InteractableActor.generated.h"
+
+/// Shared base for placed interactables and target containers. These actors react to events, so they don't tick by default.
+/// Subclasses that need a tick opt in by setting PrimaryActorTick.bCanEverTick in their constructor, and Blueprints that
+/// implement Event Tick are opted in automatically. Most of those ticks move platforms, doors and bridges, so they are only handed
+/// to the UVesselSignificanceSubsystem when bThrottleTickBySignificance is set.
+UCLASS(ABSTRACT)
+class SPEEGYPT_API AInteractableActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	AInteractableActor();
+
+	/// How much this actor matters to gameplay when it ticks, from 0 to 1. See UVesselSignificanceSubsystem.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	float SignificanceRelevance = 0.5f;
+
+	/// Lets the UVesselSignificanceSubsystem lower this actor's tick rate when it is far away or hidden.
+	/// Only set it on actors whose tick is purely cosmetic, a throttled mover falls behind or skips its triggers.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	bool bThrottleTickBySignificance = false;
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
+#include "InteractableActor.h"
 #include "Interactable.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/CyanVesselTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/MagentaVesselTarget.h"
@@ -11,7 +11,7 @@
 #include "InteractableTargetContainer.generated.h"
 
 UCLASS()
-class SPEEGYPT_API AInteractableTargetContainer : public AActor, public IInteractable
+class SPEEGYPT_API AInteractableTargetContainer : public AInteractableActor, public IInteractable
 {
 	GENERATED_BODY()
 	
@@ -27,13 +27,4 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	UYellowVesselTarget* YellowTarget;
-
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 };
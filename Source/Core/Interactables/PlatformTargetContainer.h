@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
+#include "InteractableActor.h"
 #include "../Equipment/VesselEffects/ActiveVesselEffects/Targets/LimeVesselTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/MagentaVesselTarget.h"
 #include "../Equipment/VesselEffects/PassiveVesselEffects/VesselTargets/YellowVesselTarget.h"
@@ -11,7 +11,7 @@
 #include "PlatformTargetContainer.generated.h"
 
 UCLASS()
-class SPEEGYPT_API APlatformTargetContainer : public AActor
+class SPEEGYPT_API APlatformTargetContainer : public AInteractableActor
 {
 	GENERATED_BODY()
 
@@ -31,13 +31,4 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 		UOrangeVesselTarget* OrangeTarget;
 
-
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-public:
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 };
@@ -6,6 +6,7 @@
 #include "TextureResource.h"
 #include "CanvasItem.h"
 #include "UObject/ConstructorHelpers.h"
+#include "../Character/SpeegyptCharacter.h"
 
 ASpeegyptHUD::ASpeegyptHUD()
 {
@@ -29,8 +30,14 @@ void ASpeegyptHUD::DrawHUD()
 	const FVector2D CrosshairDrawPosition( (Center.X),
 										   (Center.Y + 20.0f));
 
+	// highlight the crosshair using the character's cached focus, so the HUD never traces on its own
+	FLinearColor CrosshairColor = FLinearColor::White;
+	ASpeegyptCharacter* Character = Cast<ASpeegyptCharacter>(GetOwningPawn());
+	if (Character && (Character->GetFocusedInteractable() || Character->GetFocusedGrabbable()))
+		CrosshairColor = FocusCrosshairColor;
+
 	// draw the crosshair
-	FCanvasTileItem TileItem( CrosshairDrawPosition, CrosshairTex->Resource, FLinearColor::White);
+	FCanvasTileItem TileItem( CrosshairDrawPosition, CrosshairTex->Resource, CrosshairColor);
 	TileItem.BlendMode = SE_BLEND_Translucent;
 	Canvas->DrawItem( TileItem );
 }
@@ -17,6 +17,10 @@ public:
 	/** Primary draw call for the HUD */
 	virtual void DrawHUD() override;
 
+	/// Crosshair colour while the player is looking at something they can interact with or grab.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FLinearColor FocusCrosshairColor = FLinearColor(1.f, 0.8f, 0.3f);
+
 private:
 	/** Crosshair asset pointer */
 	class UTexture2D* CrosshairTex;
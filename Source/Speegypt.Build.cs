@@ -8,7 +8,7 @@ public class Speegypt : ModuleRules
 	{
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "GameplayTags", "Savior3" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "GameplayTags", "Savior3", "Slate", "SlateCore", "AIModule" });
 		
 		MinFilesUsingPrecompiledHeaderOverride = 1;
 	}